@@ -0,0 +1,322 @@
+"""
+Benchmarks the models in tests/integration/models and scaled up synthetic
+models. Each model runs in a separate process with instrumented GAMSPy
+internals. Results are written as JSON and can be compared with a stored
+baseline:
+
+    python scripts/benchmark.py --output baseline.json
+    python scripts/benchmark.py --baseline baseline.json --threshold 0.2
+
+scripts/performance.py only measures the wall time of the whole model test
+suite. This script breaks the time down by model and phase, which is what
+a regression check against a baseline needs.
+"""
+from __future__ import annotations
+
+import argparse
+import fnmatch
+import glob
+import io
+import json
+import os
+import platform
+import resource
+import runpy
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+ROOT_DIRECTORY = Path(__file__).parent.parent
+MODELS_DIRECTORY = os.path.join(
+    ROOT_DIRECTORY, "tests", "integration", "models"
+)
+SYNTHETIC_SIZES = [100, 400]
+
+# Metrics that are compared against the baseline
+TIME_METRICS = [
+    "total_time",
+    "generation_time",
+    "preprocess_time",
+    "gdx_write_time",
+    "gdx_read_time",
+    "solve_time",
+]
+METRICS = TIME_METRICS + [
+    "gams_string_size",
+    "peak_rss_mb",
+    "peak_rss_children_mb",
+]
+
+
+def instrument(metrics: dict) -> None:
+    """Wraps the GAMSPy internals to accumulate their run times"""
+    import gamspy._backend.backend as backend
+    import gamspy._backend.batch  # noqa: F401
+    import gamspy._backend.engine  # noqa: F401
+    import gamspy._backend.neos  # noqa: F401
+    import gamspy._backend.session  # noqa: F401
+    from gamspy import Container
+
+    def timed(owner, method_name, metric, on_result=None):
+        method = getattr(owner, method_name)
+
+        def wrapper(*args, **kwargs):
+            start = time.perf_counter()
+            result = method(*args, **kwargs)
+            metrics[metric] += time.perf_counter() - start
+
+            if on_result is not None:
+                on_result(*args)
+
+            return result
+
+        setattr(owner, method_name, wrapper)
+
+    def add_code_size(container, file, *args):
+        # The GAMS code is streamed into the file instead of being returned
+        if isinstance(file, io.StringIO):
+            metrics["gams_string_size"] += len(file.getvalue())
+        else:
+            file.flush()
+            metrics["gams_string_size"] += os.fstat(file.fileno()).st_size
+
+    timed(Container, "_write_gams_code", "generation_time", add_code_size)
+    timed(Container, "write", "gdx_write_time")
+    timed(Container, "loadRecordsFromGdx", "gdx_read_time")
+    timed(backend.Backend, "preprocess", "preprocess_time")
+
+    # Each backend implements its own run
+    for backend_class in get_subclasses(backend.Backend):
+        if "run" in vars(backend_class):
+            timed(backend_class, "run", "solve_time")
+
+
+def get_subclasses(cls: type) -> set[type]:
+    subclasses = set()
+    for subclass in cls.__subclasses__():
+        subclasses |= {subclass} | get_subclasses(subclass)
+
+    return subclasses
+
+
+def synthetic_transport(size: int) -> None:
+    """Transportation model with size x size routes"""
+    import numpy as np
+
+    from gamspy import Container, Equation, Model, Parameter, Sense, Set
+    from gamspy import Sum, Variable
+
+    rng = np.random.default_rng(seed=size)
+
+    m = Container()
+    i = Set(m, "i", records=[f"p{idx}" for idx in range(size)])
+    j = Set(m, "j", records=[f"m{idx}" for idx in range(size)])
+
+    a = Parameter(m, "a", domain=[i], records=rng.uniform(300, 600, size))
+    b = Parameter(m, "b", domain=[j], records=rng.uniform(100, 250, size))
+    c = Parameter(
+        m, "c", domain=[i, j], records=rng.uniform(1, 10, (size, size))
+    )
+
+    x = Variable(m, "x", domain=[i, j], type="Positive")
+    supply = Equation(m, "supply", domain=[i])
+    demand = Equation(m, "demand", domain=[j])
+    supply[i] = Sum(j, x[i, j]) <= a[i]
+    demand[j] = Sum(i, x[i, j]) >= b[j]
+
+    transport = Model(
+        m,
+        "transport",
+        equations=m.getEquations(),
+        problem="LP",
+        sense=Sense.MIN,
+        objective=Sum((i, j), c[i, j] * x[i, j]),
+    )
+    transport.solve()
+
+    # Change the data and solve again to measure the transfers
+    b.setRecords(rng.uniform(100, 250, size))
+    transport.solve()
+    _ = x.records
+
+
+SYNTHETIC_MODELS = {"transport": synthetic_transport}
+
+
+def run_worker(name: str) -> None:
+    """Runs a single model and prints its metrics as JSON"""
+    metrics = {metric: 0 for metric in METRICS}
+    instrument(metrics)
+
+    start = time.perf_counter()
+    with tempfile.TemporaryDirectory() as directory:
+        os.chdir(directory)
+
+        if name.startswith("synthetic:"):
+            _, model_name, size = name.split(":")
+            SYNTHETIC_MODELS[model_name](int(size))
+        else:
+            runpy.run_path(
+                os.path.join(MODELS_DIRECTORY, name), run_name="__main__"
+            )
+
+    metrics["total_time"] = time.perf_counter() - start
+
+    # ru_maxrss is in kilobytes on Linux and in bytes on macOS
+    unit = 1024 * 1024 if sys.platform == "darwin" else 1024
+    metrics["peak_rss_mb"] = (
+        resource.getrusage(resource.RUSAGE_SELF).ru_maxrss / unit
+    )
+    metrics["peak_rss_children_mb"] = (
+        resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss / unit
+    )
+
+    print(json.dumps(metrics))
+
+
+def get_model_names(pattern: str, sizes: list[int]) -> list[str]:
+    names = sorted(
+        os.path.basename(path)
+        for path in glob.glob(os.path.join(MODELS_DIRECTORY, "*.py"))
+    )
+    names += [
+        f"synthetic:{model_name}:{size}"
+        for model_name in SYNTHETIC_MODELS.keys()
+        for size in sizes
+    ]
+
+    return [name for name in names if fnmatch.fnmatch(name, pattern)]
+
+
+def benchmark(name: str, iters: int, env: dict) -> dict | None:
+    runs = []
+    for _ in range(iters):
+        process = subprocess.run(
+            [sys.executable, __file__, "--worker", name],
+            env=env,
+            capture_output=True,
+            text=True,
+        )
+
+        if process.returncode != 0:
+            print(f"(x) {name}\n{process.stderr}")
+            return None
+
+        runs.append(json.loads(process.stdout.strip().splitlines()[-1]))
+
+    return {
+        metric: statistics.median(run[metric] for run in runs)
+        for metric in METRICS
+    }
+
+
+def compare(
+    results: dict, baseline: dict, threshold: float, min_time: float
+) -> list[str]:
+    """Prints the relative changes and returns the regressions"""
+    regressions = []
+    print(f"\n{'model':<32}{'metric':<24}{'baseline':>12}{'current':>12}")
+    for name, metrics in results.items():
+        if name not in baseline:
+            continue
+
+        for metric in METRICS:
+            old, new = baseline[name][metric], metrics[metric]
+            if old == 0:
+                continue
+
+            change = (new - old) / old
+            marker = ""
+            if (
+                metric in TIME_METRICS
+                and change > threshold
+                and new - old > min_time
+            ):
+                marker = " (!)"
+                regressions.append(f"{name} {metric}")
+
+            print(
+                f"{name:<32}{metric:<24}{old:>12.4f}{new:>12.4f}"
+                f" {change:+.1%}{marker}"
+            )
+
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--iters", default=3, type=int)
+    parser.add_argument("--delayed", action="store_true")
+    parser.add_argument("--filter", default="*", help="Glob of model names")
+    parser.add_argument(
+        "--sizes", default=SYNTHETIC_SIZES, type=int, nargs="*"
+    )
+    parser.add_argument("--output", help="Path of the JSON output")
+    parser.add_argument("--baseline", help="Path of the baseline JSON")
+    parser.add_argument(
+        "--threshold",
+        default=0.1,
+        type=float,
+        help="Relative slowdown that counts as a regression",
+    )
+    parser.add_argument(
+        "--min-time",
+        default=0.05,
+        type=float,
+        help="Absolute slowdown in seconds that is ignored",
+    )
+    parser.add_argument("--worker", help=argparse.SUPPRESS)
+    args = parser.parse_args()
+
+    if args.worker:
+        run_worker(args.worker)
+        return
+
+    env = os.environ.copy()
+    env["DELAYED_EXECUTION"] = "1" if args.delayed else "0"
+
+    results = {}
+    names = get_model_names(args.filter, args.sizes)
+    for idx, name in enumerate(names):
+        print(f"[{idx + 1}/{len(names)}] {name}")
+        metrics = benchmark(name, args.iters, env)
+        if metrics is not None:
+            results[name] = metrics
+
+    import gamspy
+
+    output = {
+        "machine": {
+            "platform": platform.platform(),
+            "processor": platform.processor(),
+            "python": platform.python_version(),
+            "gamspy": gamspy.__version__,
+        },
+        "delayed_execution": args.delayed,
+        "iters": args.iters,
+        "results": results,
+    }
+
+    if args.output:
+        with open(args.output, "w") as file:
+            json.dump(output, file, indent=4)
+    else:
+        print(json.dumps(output, indent=4))
+
+    if args.baseline:
+        with open(args.baseline) as file:
+            baseline = json.load(file)["results"]
+
+        regressions = compare(
+            results, baseline, args.threshold, args.min_time
+        )
+        if regressions:
+            print("\nRegressions:\n" + "\n".join(regressions))
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -39,6 +39,9 @@ from gamspy._algebra import Smin
 from gamspy._algebra import Sum
 from gamspy._backend.engine import EngineConfig
 from gamspy._backend.neos import NeosClient
+from gamspy._backend.neos import NeosJobPool
+from gamspy._cache import DiskCache
+from gamspy._cache import SolveCache
 from gamspy._container import Container
 from gamspy._model import Model
 from gamspy._model import ModelStatus
@@ -81,5 +84,8 @@ __all__ = [
     "Options",
     "EngineConfig",
     "NeosClient",
+    "NeosJobPool",
+    "SolveCache",
+    "DiskCache",
     "SpecialValues",
 ]
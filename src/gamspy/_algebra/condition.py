@@ -70,8 +70,9 @@ class Condition:
             isinstance(condition, expression.Expression)
             and condition.data in sign_map.keys()
         ):
-            condition.data = sign_map[condition.data]
-            condition.representation = condition._create_representation()
+            condition = expression.Expression(
+                condition.left, sign_map[condition.data], condition.right
+            )
         return expression.Expression(self._symbol, "$", condition)
 
     def __setitem__(self, condition_expression, right_hand_expression) -> None:
@@ -0,0 +1,475 @@
+#
+# GAMS - General Algebraic Modeling System Python API
+#
+# Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+# Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+from __future__ import annotations
+
+from typing import Any
+from typing import TYPE_CHECKING
+
+import numpy as np
+import pandas as pd
+
+import gamspy as gp
+import gamspy._algebra.expression as expression
+import gamspy._algebra.number as number
+import gamspy._algebra.operation as operation
+import gamspy._symbols.implicits as implicits
+
+if TYPE_CHECKING:
+    from gamspy import Alias, Parameter, Set
+
+# Assignments that need larger dense arrays are evaluated by GAMS
+MAX_EVALUATION_SIZE = 10_000_000
+
+# Columns of the records of variables and equations by attribute name.
+# Only the attributes whose default value is zero can be evaluated.
+ATTRIBUTE_COLUMNS = {"l": "level", "m": "marginal"}
+
+ARITHMETIC_OPERATORS = {
+    "+": np.add,
+    "-": np.subtract,
+    "*": np.multiply,
+    "/": np.divide,
+}
+
+RELATIONAL_OPERATORS = {
+    "<": np.less,
+    "<=": np.less_equal,
+    "=l=": np.less_equal,
+    ">": np.greater,
+    ">=": np.greater_equal,
+    "=g=": np.greater_equal,
+    "eq": np.equal,
+    "=e=": np.equal,
+    "ne": np.not_equal,
+}
+
+LOGICAL_OPERATORS = {
+    "and": np.logical_and,
+    "or": np.logical_or,
+    "xor": np.logical_xor,
+}
+
+# Reductions and the values that masked out elements contribute to them
+REDUCTIONS = {
+    "sum": (np.sum, 0.0),
+    "prod": (np.prod, 1.0),
+    "smax": (np.max, -np.inf),
+    "smin": (np.min, np.inf),
+}
+
+
+class EvaluationError(Exception):
+    """Raised for constructs that must be evaluated by GAMS."""
+
+
+class Value:
+    """Dense array and the names of the indices of its axes."""
+
+    def __init__(self, array: np.ndarray, indices: tuple[str, ...]) -> None:
+        self.array = array
+        self.indices = indices
+
+
+class Evaluator:
+    """
+    Evaluates the right-hand side of a parameter assignment vectorized
+    over the records of the symbols in NumPy. Each index of the assignment
+    becomes an axis over the records of its set. Any construct that cannot
+    be evaluated with the same semantics as GAMS raises EvaluationError.
+    """
+
+    def __init__(self) -> None:
+        # labels of the records of the sets by index name
+        self.labels: dict[str, pd.Index] = {}
+        self.controlled: set[str] = set()
+
+    def evaluate_assignment(
+        self, parameter: Parameter, domain: list, assignment: Any
+    ) -> np.ndarray:
+        if len(domain) != parameter.dimension:
+            raise EvaluationError("Partial assignments are evaluated by GAMS")
+
+        indices = []
+        for index, domain_set in zip(domain, parameter.domain):
+            if isinstance(domain_set, str) or _root(index) is not _root(
+                domain_set
+            ):
+                raise EvaluationError(
+                    "Assignments over subsets are evaluated by GAMS"
+                )
+
+            indices.append(self._control(index))
+
+        value = self.evaluate(assignment)
+        array = self._expand(value, tuple(indices))
+
+        if not np.isfinite(array).all() or (
+            np.signbit(array) & (array == 0)
+        ).any():
+            # Let GAMS report the errors or handle the special values.
+            # Negative zeros are EPS and GAMS decides whether they stay EPS.
+            raise EvaluationError("Result contains special values")
+
+        return array
+
+    def evaluate(self, operand: Any) -> Value:
+        if isinstance(operand, (bool, int, float)):
+            return self._scalar(float(operand))
+
+        if isinstance(operand, number.Number):
+            return self._scalar(float(operand._value))
+
+        if isinstance(operand, gp.Parameter):
+            return self._parameter(operand, list(operand.domain))
+
+        if isinstance(operand, implicits.ImplicitParameter):
+            return self._implicit_parameter(operand)
+
+        if isinstance(operand, implicits.ImplicitSet):
+            return self._implicit_set(operand)
+
+        if isinstance(operand, operation.Card):
+            return self._card(operand)
+
+        if isinstance(operand, operation.Operation):
+            return self._operation(operand)
+
+        if isinstance(operand, expression.Expression):
+            return self._expression(operand)
+
+        raise EvaluationError(f"Cannot evaluate {type(operand)}")
+
+    def _scalar(self, value: float) -> Value:
+        _check_values(np.array([value]))
+        return Value(np.array(value), ())
+
+    def _control(self, index: Set | Alias) -> str:
+        name = self._add_index(index)
+        if name in self.controlled:
+            raise EvaluationError(f"`{name}` is already under control")
+
+        self.controlled.add(name)
+        return name
+
+    def _add_index(self, index: Any) -> str:
+        if not isinstance(index, (gp.Set, gp.Alias)) or index.dimension != 1:
+            raise EvaluationError(f"Cannot evaluate index {index}")
+
+        if index.name not in self.labels:
+            records = index.records
+            labels = (
+                []
+                if records is None
+                else records.iloc[:, 0].to_numpy(dtype=object)
+            )
+            self.labels[index.name] = pd.Index(labels).str.casefold()
+
+        return index.name
+
+    def _get_indices(self, domain: list) -> tuple[str, ...]:
+        indices = tuple(self._add_index(index) for index in domain)
+        if len(set(indices)) != len(indices):
+            raise EvaluationError("Repeated indices are evaluated by GAMS")
+
+        for index in indices:
+            if index not in self.controlled:
+                raise EvaluationError(f"Uncontrolled index `{index}`")
+
+        return indices
+
+    def _shape(self, indices: tuple[str, ...]) -> tuple[int, ...]:
+        shape = tuple(len(self.labels[index]) for index in indices)
+        if np.prod(shape, dtype=float) > MAX_EVALUATION_SIZE:
+            raise EvaluationError("Dense arrays would be too large")
+
+        return shape
+
+    def _scatter(
+        self, records: pd.DataFrame | None, indices: tuple[str, ...], column
+    ) -> Value:
+        """Places the records at the positions of their labels"""
+        array = np.zeros(self._shape(indices))
+        if records is None or len(records) == 0:
+            return Value(array, indices)
+
+        values = records[column].to_numpy(dtype=float)
+        _check_values(values)
+
+        positions = []
+        for column_index, index in enumerate(indices):
+            labels = records.iloc[:, column_index].astype(str).str.casefold()
+            positions.append(self.labels[index].get_indexer(labels))
+
+        # Records outside of the sets of the indices are not referenced
+        inside = np.ones(len(records), dtype=bool)
+        for position in positions:
+            inside &= position >= 0
+
+        array[tuple(position[inside] for position in positions)] = values[
+            inside
+        ]
+
+        return Value(array, indices)
+
+    def _check_domain(self, symbol: Any, domain: list) -> None:
+        # GAMS reports indices outside of the declared domain, e.g. q(i)
+        # for a parameter q(j)
+        for index, domain_set in zip(domain, symbol.domain):
+            if not _is_within(index, domain_set):
+                raise EvaluationError(
+                    f"Indices are not in the domain of {symbol.name}"
+                )
+
+    def _parameter(self, parameter: Parameter, domain: list) -> Value:
+        self._check_domain(parameter, domain)
+        indices = self._get_indices(domain)
+        return self._scatter(parameter.records, indices, "value")
+
+    def _implicit_parameter(
+        self, implicit: implicits.ImplicitParameter
+    ) -> Value:
+        parent = implicit.parent
+        if isinstance(parent, gp.Parameter):
+            if implicit.name == parent.name:
+                return self._parameter(parent, implicit.domain)
+
+            if implicit.name == f"-{parent.name}":
+                value = self._parameter(parent, implicit.domain)
+                return Value(-value.array, value.indices)
+
+        if isinstance(parent, (gp.Variable, gp.Equation)):
+            name, _, attribute = implicit.name.partition(".")
+            if name == parent.name and attribute in ATTRIBUTE_COLUMNS:
+                self._check_domain(parent, implicit.domain)
+                indices = self._get_indices(implicit.domain)
+                return self._scatter(
+                    parent.records, indices, ATTRIBUTE_COLUMNS[attribute]
+                )
+
+        raise EvaluationError(f"Cannot evaluate {implicit.gamsRepr()}")
+
+    def _implicit_set(self, implicit: implicits.ImplicitSet) -> Value:
+        parent = implicit.parent
+        if implicit.name != parent.name or not isinstance(parent, gp.Set):
+            raise EvaluationError(f"Cannot evaluate {implicit.gamsRepr()}")
+
+        self._check_domain(parent, implicit.domain)
+        indices = self._get_indices(implicit.domain)
+        records = parent.records
+        if records is not None:
+            records = records.assign(value=1.0)
+
+        return self._scatter(records, indices, "value")
+
+    def _card(self, card: operation.Card) -> Value:
+        symbol = card._symbol
+        if not isinstance(symbol, (gp.Set, gp.Alias, gp.Parameter)):
+            raise EvaluationError("Cannot evaluate the card of this symbol")
+
+        records = symbol.records
+        return self._scalar(0.0 if records is None else float(len(records)))
+
+    def _operation(self, op: operation.Operation) -> Value:
+        if op._op_name not in REDUCTIONS:
+            raise EvaluationError(f"Cannot evaluate {op._op_name}")
+
+        reduce, neutral = REDUCTIONS[op._op_name]
+
+        indices = []
+        conditions = []
+        for index in op.domain:
+            if (
+                isinstance(index, expression.Expression)
+                and index.data == "$"
+            ):
+                conditions.append(index.right)
+                index = index.left
+
+            indices.append(self._control(index))
+
+        try:
+            masks = [self.evaluate(condition) for condition in conditions]
+            value = self.evaluate(op.expression)
+        finally:
+            self.controlled.difference_update(indices)
+
+        all_indices = tuple(
+            dict.fromkeys(
+                [
+                    *value.indices,
+                    *[index for mask in masks for index in mask.indices],
+                    *indices,
+                ]
+            )
+        )
+        array = self._expand(value, all_indices)
+        for mask in masks:
+            array = np.where(self._expand(mask, all_indices), array, neutral)
+
+        axes = tuple(all_indices.index(index) for index in indices)
+        remaining = tuple(
+            index for index in all_indices if index not in indices
+        )
+
+        # The neutral value is also the result of reductions over empty sets
+        return Value(reduce(array, axis=axes, initial=neutral), remaining)
+
+    def _expression(self, expr: expression.Expression) -> Value:
+        if expr._is_edited:
+            # Expressions whose representation was edited can only be
+            # evaluated by GAMS
+            raise EvaluationError("Cannot evaluate edited expressions")
+
+        data = expr.data
+        if data == "-" and expr.left is None:
+            value = self.evaluate(expr.right)
+            return Value(-value.array, value.indices)
+
+        if data == "not" and isinstance(expr.left, str) and not expr.left:
+            value = self.evaluate(expr.right)
+            return Value((value.array == 0).astype(float), value.indices)
+
+        if data == "$":
+            left, right = self.evaluate(expr.left), self.evaluate(expr.right)
+            return self._combine(
+                left, right, lambda x, y: np.where(y != 0, x, 0.0)
+            )
+
+        if data == "**":
+            left, right = self.evaluate(expr.left), self.evaluate(expr.right)
+            if (left.array < 0).any():
+                # GAMS does not allow negative bases
+                raise EvaluationError("Negative base of a power")
+
+            return self._combine(left, right, np.power)
+
+        for operators in (
+            ARITHMETIC_OPERATORS,
+            RELATIONAL_OPERATORS,
+            LOGICAL_OPERATORS,
+        ):
+            if data in operators:
+                left, right = (
+                    self.evaluate(expr.left),
+                    self.evaluate(expr.right),
+                )
+                function = operators[data]
+                if operators is ARITHMETIC_OPERATORS:
+                    return self._combine(left, right, function)
+
+                return self._combine(
+                    left, right, lambda x, y: function(x, y).astype(float)
+                )
+
+        raise EvaluationError(f"Cannot evaluate operation `{data}`")
+
+    def _combine(self, left: Value, right: Value, function) -> Value:
+        indices = tuple(dict.fromkeys([*left.indices, *right.indices]))
+        self._shape(indices)
+
+        with np.errstate(all="ignore"):
+            array = function(
+                self._align(left, indices), self._align(right, indices)
+            )
+
+        return Value(array, indices)
+
+    def _align(self, value: Value, indices: tuple[str, ...]) -> np.ndarray:
+        """Orders the axes of the value as the given indices and adds the
+        missing ones with length one so that the arrays broadcast."""
+        order = [
+            value.indices.index(index)
+            for index in indices
+            if index in value.indices
+        ]
+        array = np.transpose(value.array, order)
+        shape = [
+            len(self.labels[index]) if index in value.indices else 1
+            for index in indices
+        ]
+
+        return array.reshape(shape)
+
+    def _expand(self, value: Value, indices: tuple[str, ...]) -> np.ndarray:
+        return np.broadcast_to(
+            self._align(value, indices), self._shape(indices)
+        )
+
+
+def _root(index: Any) -> Any:
+    return index.alias_with if isinstance(index, gp.Alias) else index
+
+
+def _is_within(index: Any, domain_set: Any) -> bool:
+    # The labels of the domain set, its aliases and its subsets are in the
+    # domain. Any label is in the universe.
+    if isinstance(domain_set, str):
+        return True
+
+    target = _root(domain_set)
+    current = _root(index)
+    while isinstance(current, gp.Set):
+        if current is target:
+            return True
+
+        if current.dimension != 1 or isinstance(current.domain[0], str):
+            return False
+
+        current = _root(current.domain[0])
+
+    return False
+
+
+def _check_values(values: np.ndarray) -> None:
+    # Special values such as EPS, NA, UNDEF and infinities follow GAMS
+    # specific arithmetic
+    if not np.isfinite(values).all() or (
+        np.signbit(values) & (values == 0)
+    ).any():
+        raise EvaluationError("Special values are evaluated by GAMS")
+
+
+def assign(parameter: Parameter, domain: list, assignment: Any) -> bool:
+    """
+    Evaluates the assignment to the parameter in NumPy and sets the
+    records of the parameter with the result.
+
+    Returns
+    -------
+    bool
+        False if the assignment must be evaluated by GAMS instead.
+    """
+    try:
+        array = Evaluator().evaluate_assignment(parameter, domain, assignment)
+    except EvaluationError:
+        return False
+
+    if parameter.dimension == 0:
+        parameter._set_coo_records([], [float(array)])
+    else:
+        positions = np.nonzero(array)
+        parameter._set_coo_records(positions, array[positions])
+
+    return True
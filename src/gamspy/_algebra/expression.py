@@ -34,6 +34,10 @@ import gamspy._algebra.operation as operation
 import gamspy._symbols as syms
 import gamspy._symbols.implicits as implicits
 import gamspy.utils as utils
+from gamspy._algebra.writer import Action
+from gamspy._algebra.writer import GamsWriter
+from gamspy._algebra.writer import write_operand
+from gamspy._algebra.writer import write_tasks
 
 if TYPE_CHECKING:
     from gamspy import Variable
@@ -42,6 +46,35 @@ GMS_MAX_LINE_LENGTH = 80000
 LINE_LENGTH_OFFSET = 79000
 
 
+def _get_operand_task(operand):
+    if operand is None:
+        return ""
+
+    # ((((ord(n) - 1) / 10) * -1) + ((ord(n) / 10) * 0)); -> not valid
+    # ((((ord(n) - 1) / 10) * (-1)) + ((ord(n) / 10) * 0)); -> valid
+    if isinstance(operand, (int, float)) and operand < 0:
+        return f"({operand})"
+
+    return operand
+
+
+def _mark_start(writer: GamsWriter, state: list[int]) -> None:
+    state[0] = len(writer)
+
+
+def _reserve_separator(writer: GamsWriter, state: list[int]) -> None:
+    state[1] = writer.reserve()
+
+
+def _fill_separator(writer: GamsWriter, state: list[int]) -> None:
+    # get around 80000 line length limitation in GAMS
+    length = len(writer) - state[0] - 1
+    if length >= GMS_MAX_LINE_LENGTH - LINE_LENGTH_OFFSET:
+        writer.fill(state[1], "\n ")
+    else:
+        writer.fill(state[1], " ")
+
+
 class Expression(operable.Operable):
     """
     Expression of two operands and an operation.
@@ -69,57 +102,71 @@ class Expression(operable.Operable):
         self.left = left
         self.data = data
         self.right = right
-        self.representation = self._create_representation()
+        self._representation: str | None = None
+        # Edited expressions no longer match their tree
+        self._is_edited = False
         self.where = condition.Condition(self)
 
-    def _create_representation(self):
-        left_str, right_str = self._get_operand_representations()
-        out_str = self._create_output_str(left_str, right_str)
+    @property
+    def representation(self) -> str:
+        return self.gamsRepr()
+
+    @representation.setter
+    def representation(self, representation: str) -> None:
+        self._representation = representation
+        self._is_edited = True
 
-        # Adapt to GAMS quirks
+    def _create_representation(self) -> str:
         if isinstance(self.left, (domain.Domain, syms.Set, syms.Alias)):
-            return out_str[1:-1]
+            return self._render_output()[1:-1]
 
         if self.data == "$":
             # defopLS(o,p) $ sumc(o,p) <= 0.5 .. op(o,p) =e= 1;   -> not valid
             # defopLS(o,p) $ (sumc(o,p) <= 0.5) .. op(o,p) =e= 1; -> valid
-            out_str = self._fix_condition_paranthesis(out_str)
-
-        if self.data in ["=", ".."] and out_str[0] == "(":
-            # (voycap(j,k)$vc(j,k)).. sum(.) -> not valid
-            # voycap(j,k)$vc(j,k).. sum(.)   -> valid
-            indices = utils._get_matching_paranthesis_indices(out_str)
-            match_index = indices[0]
-            out_str = out_str[1:match_index] + out_str[match_index + 1 :]
-
-        return out_str
-
-    def _get_operand_representations(self) -> tuple[str, str]:
-        if self.left is None:
-            left_str = ""
-        else:
-            left_str = (
-                str(self.left)
-                if isinstance(self.left, (int, float, str))
-                else self.left.gamsRepr()
-            )
-
-        if self.right is None:
-            right_str = ""
+            return self._fix_condition_paranthesis(self._render_output())
+
+        return self._render_output()
+
+    def _render_output(self) -> str:
+        writer = GamsWriter()
+        write_tasks(writer, self._get_output_tasks())
+        return writer.getvalue()
+
+    def _get_write_tasks(self) -> list:
+        # Conditions and domains need to see their whole output to adapt to
+        # GAMS quirks. They are rendered separately and reused afterwards.
+        if (
+            self._representation is not None
+            or self.data == "$"
+            or isinstance(self.left, (domain.Domain, syms.Set, syms.Alias))
+        ):
+            return [self.gamsRepr()]
+
+        return self._get_output_tasks()
+
+    def _get_output_tasks(self) -> list:
+        is_statement = self.data in ["..", "="]
+        is_comparison = self.data in [
+            "=g=",
+            "=l=",
+            "=e=",
+            "=n=",
+            "=x=",
+            "=c=",
+            "=b=",
+        ]
+
+        # [start position, index of the separator after the operator]
+        state = [0, 0]
+        tasks: list = [] if is_statement or is_comparison else ["("]
+        tasks.append(Action(_mark_start, state))
+
+        if is_statement and self.left is not None:
+            tasks.append(self._get_left_statement_str())
         else:
-            right_str = (
-                str(self.right)
-                if isinstance(self.right, (int, float, str))
-                else self.right.gamsRepr()
-            )
-
-        # ((((ord(n) - 1) / 10) * -1) + ((ord(n) / 10) * 0)); -> not valid
-        # ((((ord(n) - 1) / 10) * (-1)) + ((ord(n) / 10) * 0)); -> valid
-        if isinstance(self.left, (int, float)) and self.left < 0:
-            left_str = f"({left_str})"
+            tasks.append(_get_operand_task(self.left))
 
-        if isinstance(self.right, (int, float)) and self.right < 0:
-            right_str = f"({right_str})"
+        tasks += [" ", self.data, Action(_reserve_separator, state)]
 
         if self.data == "=" and isinstance(
             self.left,
@@ -127,24 +174,39 @@ class Expression(operable.Operable):
         ):
             # error02(s1,s2) = (lfr(s1,s2) and sum(l(root,s,s1,s2),1) =e= 0); -> not valid
             # error02(s1,s2) = (lfr(s1,s2) and sum(l(root,s,s1,s2),1) = 0); -> valid
-            right_str = utils._replace_equality_signs(right_str)
+            tasks += [
+                Action(
+                    GamsWriter.push_replacements,
+                    utils.EQUALITY_SIGN_REPLACEMENTS,
+                ),
+                _get_operand_task(self.right),
+                Action(GamsWriter.pop_replacements),
+            ]
+        else:
+            tasks.append(_get_operand_task(self.right))
 
-        return left_str, right_str
+        tasks.append(Action(_fill_separator, state))
 
-    def _create_output_str(self, left_str: str, right_str: str) -> str:
-        # get around 80000 line length limitation in GAMS
-        length = len(left_str) + len(self.data) + len(right_str)
-        if length >= GMS_MAX_LINE_LENGTH - LINE_LENGTH_OFFSET:
-            out_str = f"{left_str} {self.data}\n {right_str}"
-        else:
-            out_str = f"{left_str} {self.data} {right_str}"
+        if is_statement:
+            tasks.append(";")
+        elif not is_comparison:
+            tasks.append(")")
 
-        if self.data in ["..", "="]:
-            return f"{out_str};"
-        elif self.data in ["=g=", "=l=", "=e=", "=n=", "=x=", "=c=", "=b="]:
-            return out_str
+        return tasks
 
-        return f"({out_str})"
+    def _get_left_statement_str(self) -> str:
+        writer = GamsWriter()
+        write_operand(writer, _get_operand_task(self.left))
+        left_str = writer.getvalue()
+
+        if left_str and left_str[0] == "(":
+            # (voycap(j,k)$vc(j,k)).. sum(.) -> not valid
+            # voycap(j,k)$vc(j,k).. sum(.)   -> valid
+            indices = utils._get_matching_paranthesis_indices(left_str)
+            match_index = indices[0]
+            left_str = left_str[1:match_index] + left_str[match_index + 1 :]
+
+        return left_str
 
     def __eq__(self, other):  # type: ignore
         return Expression(self, "=e=", other)
@@ -164,17 +226,22 @@ class Expression(operable.Operable):
         return string
 
     def replace(self, a: str, b: str):
-        self.representation = b.join(self.representation.rsplit(a, 1))
+        self._representation = b.join(self.gamsRepr().rsplit(a, 1))
+        self._is_edited = True
 
     def gamsRepr(self) -> str:
         """
-        Representation of this Expression in GAMS language.
+        Representation of this Expression in GAMS language. The expression
+        tree is rendered once in a single pass and the result is reused.
 
         Returns
         -------
         str
         """
-        return self.representation
+        if self._representation is None:
+            self._representation = self._create_representation()
+
+        return self._representation
 
     def getStatement(self) -> str:
         """
@@ -32,6 +32,9 @@ import gamspy._algebra.expression as expression
 import gamspy._algebra.operable as operable
 import gamspy._symbols.implicits as implicits
 import gamspy.utils as utils
+from gamspy._algebra.writer import Action
+from gamspy._algebra.writer import GamsWriter
+from gamspy._algebra.writer import write_tasks
 
 if TYPE_CHECKING:
     from gams.transfer import Set, Alias, Parameter
@@ -40,6 +43,8 @@ if TYPE_CHECKING:
     from gamspy._symbols.implicits import ImplicitVariable
     from gamspy._symbols.implicits import ImplicitParameter
 
+OPERATION_REPLACEMENTS = (("=l=", "<="), ("=g=", ">="), ("=e=", "eq"))
+
 
 class Operation(operable.Operable):
     def __init__(
@@ -54,6 +59,7 @@ class Operation(operable.Operable):
         assert len(self.domain) > 0, "Operation requires at least one index"
         self.expression = expression
         self._op_name = op_name
+        self._representation: str | None = None
 
         # allow conditions
         self.where = condition.Condition(self)
@@ -94,42 +100,46 @@ class Operation(operable.Operable):
     def __neg__(self):
         return expression.Expression(None, "-", self)
 
-    def _replace_operations(self, output: str) -> str:
-        output = output.replace("=l=", "<=")
-        output = output.replace("=g=", ">=")
-        output = output.replace("=e=", "eq")
-
-        return output
+    def _get_write_tasks(self) -> list:
+        # Operations are often shared by many expressions, e.g. the same
+        # sum in several equations. They are rendered once on their own and
+        # the result is reused wherever they appear.
+        return [self.gamsRepr()]
 
-    def gamsRepr(self) -> str:
+    def _get_output_tasks(self) -> list:
         # Ex: sum((i,j), c(i,j) * x(i,j))
-        output = f"{self._op_name}("
-
-        index_str = self._get_index_str()
-
-        output += index_str
-        output += ","
-
-        if isinstance(self.expression, float):
-            self.expression = utils._map_special_values(self.expression)
+        operand = self.expression
+        if isinstance(operand, bool):
+            operand = "yes" if operand is True else "no"
+        elif isinstance(operand, float):
+            operand = utils._map_special_values(operand)
+
+        return [
+            Action(GamsWriter.push_replacements, OPERATION_REPLACEMENTS),
+            f"{self._op_name}(",
+            self._get_index_str(),
+            ",",
+            operand,
+            ")",
+            Action(GamsWriter.pop_replacements),
+        ]
 
-        if isinstance(self.expression, bool):
-            self.expression = (
-                "yes" if self.expression is True else "no"  # type: ignore
-            )
-
-        expression_str = (
-            str(self.expression)
-            if isinstance(self.expression, (int, str))
-            else self.expression.gamsRepr()
-        )
-
-        output += expression_str
-        output += ")"
-
-        output = self._replace_operations(output)
-
-        return output
+    def gamsRepr(self) -> str:
+        """
+        Representation of this Operation in GAMS language. Operations do
+        not change after their creation, so the representation is rendered
+        once and reused.
+
+        Returns
+        -------
+        str
+        """
+        if self._representation is None:
+            writer = GamsWriter()
+            write_tasks(writer, self._get_output_tasks())
+            self._representation = writer.getvalue()
+
+        return self._representation
 
 
 class Sum(Operation):
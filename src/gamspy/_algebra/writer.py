@@ -0,0 +1,158 @@
+#
+# GAMS - General Algebraic Modeling System Python API
+#
+# Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+# Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+from __future__ import annotations
+
+
+class GamsWriter:
+    """
+    Collects the pieces of GAMS code generated while traversing an
+    expression tree and concatenates them only once at the end.
+
+    Examples
+    --------
+    >>> writer = GamsWriter()
+    >>> writer.write("x")
+    >>> writer.write(" + ")
+    >>> writer.write("y")
+    >>> writer.getvalue()
+    'x + y'
+    """
+
+    def __init__(self) -> None:
+        self._pieces: list[str] = []
+        self._length = 0
+        self._replacements: list[tuple[tuple[str, str], ...]] = []
+
+    def __len__(self) -> int:
+        return self._length
+
+    def write(self, string: str) -> None:
+        """
+        Appends the given string after applying the active replacements.
+
+        Parameters
+        ----------
+        string : str
+        """
+        if self._replacements:
+            for old, new in self._replacements[-1]:
+                string = string.replace(old, new)
+
+        self._pieces.append(string)
+        self._length += len(string)
+
+    def reserve(self) -> int:
+        """
+        Reserves a slot whose content can be decided later.
+
+        Returns
+        -------
+        int
+            Index of the slot
+        """
+        self._pieces.append("")
+        return len(self._pieces) - 1
+
+    def fill(self, index: int, string: str) -> None:
+        """
+        Fills the reserved slot with the given string.
+
+        Parameters
+        ----------
+        index : int
+            Index of the slot returned by reserve
+        string : str
+        """
+        self._pieces[index] = string
+        self._length += len(string)
+
+    def push_replacements(self, replacements: tuple[tuple[str, str], ...]):
+        """
+        Applies the given replacements to all strings written until
+        pop_replacements is called. Nested replacements shadow the outer
+        ones.
+
+        Parameters
+        ----------
+        replacements : tuple[tuple[str, str], ...]
+            Pairs of old and new substrings
+        """
+        self._replacements.append(replacements)
+
+    def pop_replacements(self) -> None:
+        self._replacements.pop()
+
+    def getvalue(self) -> str:
+        """
+        Concatenated GAMS code
+
+        Returns
+        -------
+        str
+        """
+        return "".join(self._pieces)
+
+
+class Action:
+    """
+    A deferred call on the writer that is executed when the traversal
+    reaches it.
+    """
+
+    __slots__ = ("function", "args")
+
+    def __init__(self, function, *args) -> None:
+        self.function = function
+        self.args = args
+
+
+def write_tasks(writer: GamsWriter, tasks: list) -> None:
+    """
+    Writes the given tasks in order. A task is either a string, an Action,
+    a node that provides its own tasks via _get_write_tasks or any other
+    operand. The traversal uses an explicit stack so that deeply nested
+    expressions such as long sums built term by term do not hit the
+    recursion limit.
+    """
+    stack = list(reversed(tasks))
+
+    while stack:
+        task = stack.pop()
+
+        if isinstance(task, str):
+            writer.write(task)
+        elif isinstance(task, Action):
+            task.function(writer, *task.args)
+        elif hasattr(task, "_get_write_tasks"):
+            stack.extend(reversed(task._get_write_tasks()))
+        elif isinstance(task, (int, float)):
+            writer.write(str(task))
+        else:
+            writer.write(task.gamsRepr())
+
+
+def write_operand(writer: GamsWriter, operand) -> None:
+    """Writes an operand of an expression or an operation to the writer."""
+    write_tasks(writer, [operand])
@@ -1,8 +1,11 @@
 from __future__ import annotations
 
 import os
+import time
+import uuid
 from abc import ABC
 from abc import abstractmethod
+from contextlib import contextmanager
 from typing import Literal
 from typing import TYPE_CHECKING
 
@@ -15,6 +18,7 @@ if TYPE_CHECKING:
     from gamspy._backend.engine import EngineConfig, GAMSEngine
     from gamspy._backend.neos import NeosClient, NEOSServer
     from gamspy._backend.local import Local
+    from gamspy._backend.session import Session
     from gams import GamsOptions
     from gamspy import Container
 
@@ -45,40 +49,86 @@ HEADER = [
     "Solver Time",
 ]
 
+# Phases of a run and their columns in the summary
+TIMING_HEADER = {
+    "tracking": "Tracking Time",
+    "validation": "Validation Time",
+    "gdx_write": "GDX Write Time",
+    "generation": "Generation Time",
+    "gams": "GAMS Time",
+    "gdx_read": "GDX Read Time",
+}
+TRANSFER_HEADER = ["Bytes Written", "Bytes Read"]
+
 
 def backend_factory(
     container: Container,
     options: GamsOptions | None = None,
     output: io.TextIOWrapper | None = None,
-    backend: Literal["local", "engine", "neos"] = "local",
+    backend: Literal["local", "session", "engine", "neos"] = "local",
     engine_config: EngineConfig | None = None,
     neos_client: NeosClient | None = None,
-) -> Local | GAMSEngine | NEOSServer:
+    load_symbols: list[str] | None = None,
+) -> Local | Session | GAMSEngine | NEOSServer:
+    runner: Local | Session | GAMSEngine | NEOSServer
     if backend == "neos":
         from gamspy._backend.neos import NEOSServer
 
-        return NEOSServer(container, options, neos_client)
+        runner = NEOSServer(container, options, neos_client)
     elif backend == "engine":
         from gamspy._backend.engine import GAMSEngine
 
-        return GAMSEngine(container, engine_config, options, output)
+        runner = GAMSEngine(container, engine_config, options, output)
     elif backend == "local":
         from gamspy._backend.local import Local
 
-        return Local(container, options, output)
+        runner = Local(container, options, output)
+    elif backend == "session":
+        from gamspy._backend.session import Session
+
+        runner = Session(container, options, output)
     else:
         raise ValidationError(
             f"`{backend}` is not a valid backend. Possible backends:"
-            " local, engine, and neos"
+            " local, session, engine, and neos"
         )
 
+    runner.load_symbols = load_symbols
+
+    return runner
+
 
 class Backend(ABC):
+    # Whether GAMS runs on this machine and can read the chunks of the
+    # records that are streamed from files
+    reads_local_files = True
+
     def __init__(self, container: Container, gdx_in: str, gdx_out: str):
         self.container = container
         self.gdx_in = gdx_in
         self.gdx_out = gdx_out
 
+        # Names of the symbols to be loaded after the run. None loads all
+        # symbols that were changed by GAMS.
+        self.load_symbols: list[str] | None = None
+
+        # Statements and autogenerated symbols that belong to this run. None
+        # means all of them.
+        self.num_statements: int | None = None
+        self.autogenerated_ids: list[int] | None = None
+
+        # Name of the job whose input file is generated by preprocess
+        self.job_name = f"_job_{uuid.uuid4()}"
+
+        # Durations of the phases of the run in seconds and the size of the
+        # transferred gdx files in bytes
+        self.timings: dict[str, float] = dict.fromkeys(TIMING_HEADER, 0.0)
+        self.bytes_written = 0
+        self.bytes_read = 0
+
+        # Chunk files of the parameters whose records are streamed
+        self.stream_files: dict[str, list[str]] = {}
+
     @abstractmethod
     def is_async(self):
         ...
@@ -88,21 +138,132 @@ class Backend(ABC):
         ...
 
     def preprocess(self, keep_flags: bool = False):
-        dirty_names, modified_names = (
-            self.container._get_touched_symbol_names()
+        self.container._wait_for_pending_run()
+        self.num_statements = len(self.container._unsaved_statements)
+        self.autogenerated_ids = list(
+            self.container._autogenerated_symbols.keys()
         )
+        self.container._preserve_deferred_records()
+        self.container._detach_shared_files()
+
+        with self.measure("tracking"):
+            dirty_names, modified_names = (
+                self.container._get_touched_symbol_names()
+            )
+        dirty_names = self.get_unload_names(dirty_names)
         self.clean_dirty_symbols(dirty_names)
-        self.container.isValid(verbose=True, force=True)
-        self.container.write(self.container._gdx_in, modified_names)
 
-        gams_string = self.container._generate_gams_string(
-            self.gdx_in, self.gdx_out, dirty_names, modified_names
+        with self.measure("validation"):
+            self.container._validate_symbols(modified_names)
+
+        if not self.reads_local_files:
+            # Remote jobs only get the input gdx, so the records are sent
+            # with the other symbols
+            for name in modified_names:
+                symbol = self.container[name]
+                if getattr(symbol, "_records_file", None) is not None:
+                    symbol._load_records_file()
+
+        with self.measure("gdx_write") as attributes:
+            (
+                load_names,
+                merge_names,
+                stream_files,
+            ) = self.container._write_modified_symbols(
+                self.container._gdx_in, modified_names
+            )
+            self.stream_files = stream_files
+            self.bytes_written = self._get_file_size(self.container._gdx_in)
+            attributes["bytes"] = self.bytes_written
+
+        # Stream the GAMS code into the input file of the job
+        self.job_name = f"_job_{uuid.uuid4()}"
+        gms_path = os.path.join(
+            self.container.working_directory, self.job_name + ".gms"
         )
+        with self.measure("generation"), open(gms_path, "w") as file:
+            self.container._write_gams_code(
+                file,
+                self.gdx_in,
+                self.gdx_out,
+                dirty_names,
+                load_names,
+                merge_names,
+                stream_files,
+            )
 
         if not keep_flags:
             self.update_modified_state(modified_names)
 
-        return gams_string, dirty_names
+        return gms_path, dirty_names
+
+    @contextmanager
+    def measure(self, phase: str):
+        """
+        Measures the duration of the given phase of the run and reports it
+        to the timing callback of the container. The yielded dictionary
+        holds the attributes that are passed to the callback.
+        """
+        attributes = {"backend": self.__class__.__name__}
+        start = time.perf_counter()
+        try:
+            yield attributes
+        finally:
+            duration = time.perf_counter() - start
+            self.timings[phase] += duration
+
+            callback = self.container._timing_callback
+            if callback is not None:
+                callback(phase, duration, attributes)
+
+    def _get_file_size(self, path: str) -> int:
+        return os.path.getsize(path) if os.path.exists(path) else 0
+
+    def clean_up(self):
+        """
+        Removes the statements, the autogenerated symbols and the chunk
+        files of this run from the container. Statements that were added
+        while the run was in progress are kept.
+        """
+        del self.container._unsaved_statements[: self.num_statements]
+        self.container._delete_autogenerated_symbols(self.autogenerated_ids)
+
+        for paths in self.stream_files.values():
+            for path in paths:
+                if os.path.exists(path):
+                    os.remove(path)
+
+        self.stream_files = {}
+
+    def load_records(self, dirty_names: list[str]):
+        """
+        Loads the records of the symbols that were changed by GAMS. Loading
+        of the symbols that are not in load_symbols is deferred until their
+        records are accessed.
+        """
+        symbol_names = dirty_names + self.container._import_symbols
+
+        if self.load_symbols is not None:
+            deferred_names = [
+                name for name in dirty_names if name not in self.load_symbols
+            ]
+            self.container._defer_records(
+                deferred_names, self.container._gdx_out
+            )
+
+            symbol_names = [
+                name for name in symbol_names if name not in deferred_names
+            ]
+
+            if not symbol_names:
+                return
+
+        with self.measure("gdx_read") as attributes:
+            self.container.loadRecordsFromGdx(
+                self.container._gdx_out, symbol_names
+            )
+            self.bytes_read = self._get_file_size(self.container._gdx_out)
+            attributes["bytes"] = self.bytes_read
 
     def prepare_summary(self, working_directory: str, trace_file: str):
         from gamspy._model import ModelStatus
@@ -145,9 +306,12 @@ class Backend(ABC):
                     model_type,
                     solver_name,
                     solver_time,
+                    *self.timings.values(),
+                    self.bytes_written,
+                    self.bytes_read,
                 ]
             ],
-            columns=HEADER,
+            columns=HEADER + list(TIMING_HEADER.values()) + TRANSFER_HEADER,
         )
         return dataframe
 
@@ -156,6 +320,10 @@ class Backend(ABC):
             if not name.startswith("autogenerated_"):
                 self.container[name].modified = False
 
+    def get_unload_names(self, dirty_names: list[str]) -> list[str]:
+        """Names of the dirty symbols that the job writes to the result gdx"""
+        return dirty_names
+
     def clean_dirty_symbols(self, dirty_names: list[str]):
         for name in dirty_names:
             self.container[name]._is_dirty = False
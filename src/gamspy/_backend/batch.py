@@ -0,0 +1,486 @@
+#
+# GAMS - General Algebraic Modeling System Python API
+#
+# Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+# Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+from __future__ import annotations
+
+import os
+import shutil
+import uuid
+from concurrent.futures import Future
+from concurrent.futures import ThreadPoolExecutor
+from typing import Any
+from typing import Literal
+from typing import TYPE_CHECKING
+
+import gams.transfer as gt
+from gams import GamsJob
+from gams import GamsOptions
+from gams.control.workspace import GamsException
+from gams.control.workspace import GamsExceptionExecution
+
+import gamspy as gp
+import gamspy._backend.backend as backend
+from gamspy.exceptions import customize_exception
+from gamspy.exceptions import GamspyException
+from gamspy.exceptions import ValidationError
+
+if TYPE_CHECKING:
+    import pandas as pd
+    from gamspy import Model, Parameter
+    from gamspy._backend.engine import EngineConfig
+    from gamspy._backend.neos import NeosClient
+    from gamspy._model import ModelStatus
+
+# Model attributes that are collected for each scenario
+BATCH_ATTRIBUTES = {
+    "modelStat": "status",
+    "solveStat": "solver_status",
+    "objVal": "objective_value",
+}
+
+
+class ScenarioResult:
+    """
+    Results of a single scenario of a batch solve.
+
+    Parameters
+    ----------
+    summary : DataFrame, optional
+        Summary of the solve. None if the trace file format is not 3.
+    records : dict[str, DataFrame]
+        Records of the loaded symbols by symbol name
+    status : ModelStatus
+        Model status
+    solver_status : float
+        Solver status
+    objective_value : float
+        Objective value
+    """
+
+    def __init__(
+        self,
+        summary: pd.DataFrame | None,
+        records: dict[str, pd.DataFrame],
+        status: ModelStatus,
+        solver_status: float,
+        objective_value: float,
+    ) -> None:
+        self.summary = summary
+        self.records = records
+        self.status = status
+        self.solver_status = solver_status
+        self.objective_value = objective_value
+
+    def __repr__(self) -> str:
+        return (
+            f"ScenarioResult(status={self.status},"
+            f" objective_value={self.objective_value})"
+        )
+
+
+class ScenarioJob:
+    def __init__(
+        self,
+        job: GamsJob | None,
+        options: GamsOptions,
+        gdx_in: str,
+        gdx_out: str,
+        source: str,
+        directory: str | None = None,
+    ) -> None:
+        self.job = job
+        self.options = options
+        self.gdx_in = gdx_in
+        self.gdx_out = gdx_out
+        self.source = source
+        # Staging directory of the jobs that run on NEOS Server
+        self.directory = directory
+
+
+class Batch(backend.Backend):
+    def __init__(
+        self,
+        model: Model,
+        options: GamsOptions,
+        backend: Literal["local", "engine", "neos"] = "local",
+        engine_config: EngineConfig | None = None,
+        workers: int | None = None,
+        load_symbols: list[str] | None = None,
+        neos_client: NeosClient | None = None,
+        poll_interval: float = 5.0,
+    ) -> None:
+        if backend not in ["local", "engine", "neos"]:
+            raise ValidationError(
+                "Batch solves can only run on `local`, `engine` or `neos`"
+                f" backends but found `{backend}`"
+            )
+
+        if backend == "engine" and engine_config is None:
+            raise ValidationError(
+                "`engine_config` must be provided to solve on GAMS Engine"
+            )
+
+        if backend == "neos" and neos_client is None:
+            raise ValidationError(
+                "`neos_client` must be provided to solve on NEOS Server"
+            )
+
+        if workers is not None and workers < 1:
+            raise ValidationError("`workers` must be a positive integer")
+
+        container = model.container
+        super().__init__(container, container._gdx_in, container._gdx_out)
+        self.model = model
+        self.options = options
+        self.backend = backend
+        self.engine_config = engine_config
+        self.workers = workers if workers is not None else os.cpu_count()
+        self.load_symbols = load_symbols
+        self.neos_client = neos_client
+        self.poll_interval = poll_interval
+
+        prefix = f"{gp.Model._generate_prefix}{model.name}_batch"
+        self.attribute_names = {
+            gams_attr: f"{prefix}_{gams_attr}"
+            for gams_attr in BATCH_ATTRIBUTES.keys()
+        }
+
+    def is_async(self):
+        return False
+
+    def solve(
+        self, scenarios: list[dict[Parameter, Any]]
+    ) -> list[ScenarioResult]:
+        base_checkpoint = self.prepare_checkpoint()
+
+        # Jobs are created in the calling thread since creating a job
+        # registers it in the workspace.
+        jobs = [
+            self.preprocess_scenario(scenario, base_checkpoint)
+            for scenario in scenarios
+        ]
+
+        try:
+            with ThreadPoolExecutor(max_workers=self.workers) as executor:
+                futures = [executor.submit(self.run, job) for job in jobs]
+
+            return [
+                self.postprocess_scenario(job, future)
+                for job, future in zip(jobs, futures)
+            ]
+        finally:
+            for job in jobs:
+                self.clean_up_scenario(job)
+
+    def prepare_checkpoint(self):
+        """
+        Brings GAMS up to date so that all scenarios restart from the same
+        checkpoint and returns the checkpoint. None if nothing ran yet.
+        """
+        self.container._wait_for_pending_run()
+        if (
+            self.container._unsaved_statements
+            or self.container._modified_symbols
+        ):
+            self.container._run()
+
+        if os.path.exists(self.container._restart_from._checkpoint_file_name):
+            return self.container._restart_from
+
+        return None
+
+    def preprocess_scenario(
+        self, scenario: dict[Parameter, Any], checkpoint
+    ) -> ScenarioJob:
+        if self.backend == "neos":
+            return self._preprocess_neos_scenario(scenario)
+
+        suffix = uuid.uuid4()
+        gdx_in = f"_gdx_in_{suffix}.gdx"
+        gdx_out = f"_gdx_out_{suffix}.gdx"
+
+        options = GamsOptions(self.container.workspace, opt_from=self.options)
+        trace_file = f"_trace_{suffix}.txt"
+        options.trace = (
+            trace_file
+            if self.backend == "engine"
+            else os.path.join(self.container.working_directory, trace_file)
+        )
+
+        symbol_names = self._write_scenario(
+            scenario, os.path.join(self.container.working_directory, gdx_in)
+        )
+
+        if self.backend == "local":
+            gdx_in, gdx_out = (
+                os.path.join(self.container.working_directory, path)
+                for path in (gdx_in, gdx_out)
+            )
+
+        source = self._get_scenario_string(gdx_in, gdx_out, symbol_names)
+        job = GamsJob(
+            self.container.workspace,
+            job_name=f"_job_{suffix}",
+            source=source,
+            checkpoint=checkpoint,
+        )
+
+        return ScenarioJob(job, options, gdx_in, gdx_out, source)
+
+    def _preprocess_neos_scenario(
+        self, scenario: dict[Parameter, Any]
+    ) -> ScenarioJob:
+        # NEOS jobs always read in.gdx and write output.gdx, so each job
+        # is staged in its own directory.
+        directory = os.path.join(
+            self.container.working_directory, f"_neos_{uuid.uuid4()}"
+        )
+        os.makedirs(directory)
+
+        options = GamsOptions(self.container.workspace, opt_from=self.options)
+        symbol_names = self._write_scenario(
+            scenario, os.path.join(directory, "in.gdx")
+        )
+        source = self._get_scenario_string(
+            "in.gdx", "output.gdx", symbol_names
+        )
+
+        # The job document embeds the checkpoint, so it is prepared before
+        # the container moves on to its next checkpoint.
+        self.neos_client._prepare_xml(  # type: ignore
+            source,
+            os.path.join(directory, "in.gdx") if symbol_names else None,
+            self.container._restart_from._checkpoint_file_name,
+            "_scenario_save",
+            options=options,
+            working_directory=directory,
+        )
+
+        return ScenarioJob(
+            None,
+            options,
+            os.path.join(directory, "in.gdx"),
+            os.path.join(directory, "output.gdx"),
+            source,
+            directory,
+        )
+
+    def run(self, scenario_job: ScenarioJob):
+        if self.backend == "neos":
+            # Server proxies cannot be shared between threads
+            client = self.neos_client._copy()  # type: ignore
+            client._solve_in_directory(
+                scenario_job.directory,  # type: ignore
+                self.poll_interval,
+            )
+            return
+
+        job = scenario_job.job
+
+        try:
+            if self.backend == "engine":
+                config = self.engine_config
+                extra_model_files = [
+                    os.path.basename(extra_file)
+                    for extra_file in config.extra_model_files
+                ]
+                if os.path.exists(
+                    os.path.join(
+                        self.container.working_directory, scenario_job.gdx_in
+                    )
+                ):
+                    extra_model_files.append(scenario_job.gdx_in)
+
+                job.run_engine(  # type: ignore
+                    engine_configuration=config._get_engine_config(),
+                    extra_model_files=extra_model_files,
+                    gams_options=scenario_job.options,
+                    create_out_db=False,
+                    engine_options=config.engine_options,
+                    remove_results=config.remove_results,
+                )
+            else:
+                job.run(gams_options=scenario_job.options, create_out_db=False)
+        except GamsExceptionExecution as exception:
+            message = customize_exception(
+                self.container.workspace,
+                scenario_job.options,
+                job,
+                exception,
+            )
+            raise GamspyException(message)
+        except GamsException as exception:
+            raise GamspyException(str(exception))
+
+    def postprocess_scenario(
+        self, scenario_job: ScenarioJob, future: Future | None
+    ):
+        from gamspy._model import ModelStatus
+
+        # Raises the exception of the scenario if there is any
+        if future is not None:
+            future.result()
+
+        temp_container = gt.Container(
+            system_directory=self.container.system_directory
+        )
+        temp_container.read(
+            os.path.join(
+                self.container.working_directory, scenario_job.gdx_out
+            )
+        )
+
+        records = {
+            name: temp_container[name].records
+            for name in self._get_load_names()
+        }
+        attributes = {
+            python_attr: temp_container[
+                self.attribute_names[gams_attr]
+            ].toValue()
+            for gams_attr, python_attr in BATCH_ATTRIBUTES.items()
+        }
+
+        summary = None
+        if scenario_job.options.traceopt == 3 and self.backend != "neos":
+            trace_file = os.path.join(
+                self.container.working_directory, scenario_job.options.trace
+            )
+            summary = self.prepare_summary(
+                self.container.working_directory, trace_file
+            )
+            os.remove(trace_file)
+
+        return ScenarioResult(
+            summary,
+            records,
+            ModelStatus(attributes["status"]),
+            attributes["solver_status"],
+            attributes["objective_value"],
+        )
+
+    def solve_scenario(self, scenario_job: ScenarioJob) -> ScenarioResult:
+        """Runs a prepared scenario and collects its results"""
+        try:
+            self.run(scenario_job)
+            return self.postprocess_scenario(scenario_job, None)
+        finally:
+            self.clean_up_scenario(scenario_job)
+
+    def clean_up_scenario(self, scenario_job: ScenarioJob) -> None:
+        if scenario_job.directory is not None:
+            shutil.rmtree(scenario_job.directory, ignore_errors=True)
+            return
+
+        for path in (scenario_job.gdx_in, scenario_job.gdx_out):
+            path = os.path.join(self.container.working_directory, path)
+            if os.path.exists(path):
+                os.remove(path)
+
+    def _write_scenario(
+        self, scenario: dict[Parameter, Any], write_to: str
+    ) -> list[str]:
+        """
+        Writes the records of a scenario to the given gdx file without
+        changing the records of the container.
+        """
+        symbol_names = []
+        for parameter in scenario.keys():
+            if not isinstance(parameter, gp.Parameter):
+                raise ValidationError(
+                    "Scenario keys must be of type Parameter but found"
+                    f" {type(parameter)}"
+                )
+
+            if parameter.container is not self.container:
+                raise ValidationError(
+                    f"Parameter `{parameter.name}` does not belong to the"
+                    " container of the model"
+                )
+
+            symbol_names.append(parameter.name)
+
+        if not symbol_names:
+            return symbol_names
+
+        self.container._load_deferred_records(symbol_names)
+
+        previous_states = []
+        try:
+            for parameter, records in scenario.items():
+                previous_states.append(
+                    (
+                        parameter,
+                        parameter._records,
+                        parameter._records_file,
+                        parameter.modified,
+                    )
+                )
+                parameter.setRecords(records)
+
+            self.container.write(write_to, symbol_names)
+        finally:
+            for (
+                parameter,
+                records,
+                records_file,
+                modified,
+            ) in reversed(previous_states):
+                parameter._records = records
+                parameter._records_file = records_file
+                parameter.modified = modified
+
+        return symbol_names
+
+    def _get_scenario_string(
+        self, gdx_in: str, gdx_out: str, symbol_names: list[str]
+    ) -> str:
+        strings = []
+        if symbol_names:
+            strings.append(f"$onMultiR\n$onUNDF\n$gdxIn {gdx_in}\n")
+            for name in symbol_names:
+                strings.append(f"$load {name}\n")
+            strings.append("$offUNDF\n$gdxIn\n")
+
+        for name in self.attribute_names.values():
+            strings.append(f"Parameter {name};\n")
+
+        strings.append(self.model._get_solve_string() + "\n")
+
+        for gams_attr, name in self.attribute_names.items():
+            strings.append(f"{name} = {self.model.name}.{gams_attr};\n")
+
+        unload_names = self._get_load_names() + list(
+            self.attribute_names.values()
+        )
+        unload_str = ",".join(unload_names)
+        strings.append(f"execute_unload '{gdx_out}' {unload_str}\n")
+
+        return "".join(strings)
+
+    def _get_load_names(self) -> list[str]:
+        if self.load_symbols is not None:
+            return self.load_symbols
+
+        return [symbol.name for symbol in self.model._get_result_symbols()]
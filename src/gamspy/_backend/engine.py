@@ -24,9 +24,9 @@
 #
 from __future__ import annotations
 
+import json
 import os
 import shutil
-import uuid
 from typing import List
 from typing import Optional
 from typing import TYPE_CHECKING
@@ -56,6 +56,7 @@ class EngineConfig(BaseModel):
     extra_model_files: List[str] = []
     engine_options: Optional[dict] = None
     remove_results: bool = False
+    filter_results: bool = False
 
     class Config:
         extra = "forbid"
@@ -71,6 +72,8 @@ class EngineConfig(BaseModel):
 
 
 class GAMSEngine(backend.Backend):
+    reads_local_files = False
+
     def __init__(
         self,
         container: "Container",
@@ -98,10 +101,10 @@ class GAMSEngine(backend.Backend):
 
     def solve(self, is_implicit: bool = False, keep_flags: bool = False):
         # Generate gams string and write modified symbols to gdx
-        gams_string, dirty_names = self.preprocess(keep_flags)
+        gms_path, dirty_names = self.preprocess(keep_flags)
 
         # Run the model
-        self.run(gams_string)
+        self.run(gms_path)
 
         if self.is_async():
             return None
@@ -111,7 +114,7 @@ class GAMSEngine(backend.Backend):
 
         return summary
 
-    def run(self, gams_string: str):
+    def run(self, gms_path: str):
         extra_model_files = self._preprocess_extra_model_files()
 
         checkpoint = None
@@ -120,34 +123,31 @@ class GAMSEngine(backend.Backend):
 
         job = GamsJob(
             self.container.workspace,
-            job_name=f"_job_{uuid.uuid4()}",
-            source=gams_string,
+            file_name=gms_path,
+            job_name=self.job_name,
             checkpoint=checkpoint,
         )
 
         try:
             self.container._job = job
-            job.run_engine(  # type: ignore
-                engine_configuration=self.config._get_engine_config(),
-                extra_model_files=extra_model_files,
-                gams_options=self.options,
-                checkpoint=self.container._save_to,
-                output=self.output,
-                create_out_db=False,
-                engine_options=self.config.engine_options,
-                remove_results=self.config.remove_results,
-            )
+            with self.measure("gams"):
+                job.run_engine(  # type: ignore
+                    engine_configuration=self.config._get_engine_config(),
+                    extra_model_files=extra_model_files,
+                    gams_options=self.options,
+                    checkpoint=self.container._save_to,
+                    output=self.output,
+                    create_out_db=False,
+                    engine_options=self._get_engine_options(),
+                    remove_results=self.config.remove_results,
+                )
         except (GamsException, GamsExceptionExecution) as e:
             raise GamspyException(str(e))
         finally:
-            self.container._unsaved_statements = []
-            self.container._delete_autogenerated_symbols()
+            self.clean_up()
 
     def postprocess(self, dirty_names: List[str], is_implicit: bool = False):
-        self.container.loadRecordsFromGdx(
-            self.container._gdx_out,
-            dirty_names + self.container._import_symbols,
-        )
+        self.load_records(dirty_names)
         self.container._swap_checkpoints()
 
         if (
@@ -161,6 +161,38 @@ class GAMSEngine(backend.Backend):
             self.container.working_directory, self.options.trace
         )
 
+    def get_unload_names(self, dirty_names: list[str]) -> list[str]:
+        if not self.config.filter_results or self.load_symbols is None:
+            return dirty_names
+
+        # Only the requested symbols are written to the result gdx. The
+        # others stay dirty and are unloaded from the checkpoint by the
+        # next run that needs their records.
+        return [name for name in dirty_names if name in self.load_symbols]
+
+    def _get_engine_options(self) -> dict | None:
+        if not self.config.filter_results:
+            return self.config.engine_options
+
+        engine_options = dict(self.config.engine_options or {})
+        if "inex_string" in engine_options or "inex_file" in engine_options:
+            raise ValidationError(
+                "`filter_results` cannot be used together with `inex_string`"
+                " or `inex_file` engine options"
+            )
+
+        # Results archive contains only the files that GAMSPy reads back
+        # instead of the whole working directory of the job.
+        files = [self.gdx_out, "*.g00", "*.log", "*.lst"]
+        if self.options.trace:
+            files.append(os.path.basename(self.options.trace))
+
+        engine_options["inex_string"] = json.dumps(
+            {"type": "include", "files": files}
+        )
+
+        return engine_options
+
     def _preprocess_extra_model_files(self) -> List[str]:
         for extra_file in self.config.extra_model_files:
             try:
@@ -25,7 +25,6 @@
 from __future__ import annotations
 
 import os
-import uuid
 from typing import TYPE_CHECKING
 
 from gams import GamsJob
@@ -57,10 +56,10 @@ class Local(backend.Backend):
 
     def solve(self, is_implicit: bool = False, keep_flags: bool = False):
         # Generate gams string and write modified symbols to gdx
-        gams_string, dirty_names = self.preprocess(keep_flags)
+        gms_path, dirty_names = self.preprocess(keep_flags)
 
         # Run the model
-        self.run(gams_string)
+        self.run(gms_path)
 
         if self.is_async():
             return None
@@ -70,40 +69,37 @@ class Local(backend.Backend):
 
         return summary
 
-    def run(self, gams_string: str):
+    def run(self, gms_path: str):
         checkpoint = None
         if os.path.exists(self.container._restart_from._checkpoint_file_name):
             checkpoint = self.container._restart_from
 
         job = GamsJob(
             self.container.workspace,
-            job_name=f"_job_{uuid.uuid4()}",
-            source=gams_string,
+            file_name=gms_path,
+            job_name=self.job_name,
             checkpoint=checkpoint,
         )
 
         try:
             self.container._job = job
-            job.run(
-                gams_options=self.options,
-                checkpoint=self.container._save_to,
-                create_out_db=False,
-                output=self.output,
-            )
+            with self.measure("gams"):
+                job.run(
+                    gams_options=self.options,
+                    checkpoint=self.container._save_to,
+                    create_out_db=False,
+                    output=self.output,
+                )
         except GamsExceptionExecution as exception:
             message = customize_exception(
                 self.container.workspace, self.options, job, exception
             )
             raise GamspyException(message)
         finally:
-            self.container._unsaved_statements = []
-            self.container._delete_autogenerated_symbols()
+            self.clean_up()
 
     def postprocess(self, dirty_names: list[str], is_implicit: bool = False):
-        self.container.loadRecordsFromGdx(
-            self.container._gdx_out,
-            dirty_names + self.container._import_symbols,
-        )
+        self.load_records(dirty_names)
         self.container._swap_checkpoints()
 
         if self.options.traceopt == 3 and not is_implicit:
@@ -28,9 +28,15 @@ import base64
 import logging
 import os
 import shutil
+import threading
 import time
 import xmlrpc.client
 import zipfile
+from concurrent.futures import as_completed
+from concurrent.futures import Future
+from concurrent.futures import ThreadPoolExecutor
+from typing import Any
+from typing import Iterator
 from typing import TYPE_CHECKING
 
 import gamspy._backend.backend as backend
@@ -47,7 +53,9 @@ logger.addHandler(stream_handler)
 
 if TYPE_CHECKING:
     from gams import GamsOptions
-    from gamspy import Container
+    from gamspy import Container, Model, Options
+    from gamspy import Set, Parameter, Variable, Equation
+    from gamspy._backend.batch import ScenarioResult
 
 
 class NeosClient:
@@ -277,18 +285,20 @@ class NeosClient:
     def _prepare_xml(
         self,
         gams_string: str,
-        gdx_path: str,
+        gdx_path: str | None,
         restart_path: str,
         save_name: str,
         options: GamsOptions,
         xml_path: str = "neos.xml",
         working_directory: str = ".",
     ) -> None:
+        # Jobs without input data do not send a gdx file
         gdx_string = ""
-        with open(gdx_path, "rb") as gdx_file:
-            content = gdx_file.read()
-            gdx_base64 = base64.b64encode(content).decode("utf-8")
-            gdx_string = f"<base64>{gdx_base64}</base64>"
+        if gdx_path is not None:
+            with open(gdx_path, "rb") as gdx_file:
+                content = gdx_file.read()
+                gdx_base64 = base64.b64encode(content).decode("utf-8")
+                gdx_string = f"<base64>{gdx_base64}</base64>"
 
         restart_string = ""
         try:
@@ -328,6 +338,52 @@ class NeosClient:
         with open(os.path.join(working_directory, xml_path), "w") as neos_xml:
             neos_xml.write(template)
 
+    def _copy(self) -> NeosClient:
+        """Client with the same settings and its own server proxy"""
+        return NeosClient(
+            self.email,
+            self.server,
+            self.username,
+            self.password,
+            self.priority,
+            self.is_blocking,
+        )
+
+    def _solve_in_directory(
+        self, working_directory: str, poll_interval: float = 5.0
+    ) -> None:
+        """
+        Submits the job document in the given directory without blocking,
+        polls the status of the job until it is done and extracts its
+        output into the same directory.
+        """
+        job_number, job_password = self.submit_job(
+            is_blocking=False, working_directory=working_directory
+        )
+
+        while True:
+            status = self.get_job_status(job_number, job_password)
+            if status == "Done":
+                break
+
+            if status not in ["Running", "Waiting"]:
+                raise GamspyException(
+                    f"NEOS job {job_number} failed with status: {status}"
+                )
+
+            time.sleep(poll_interval)
+
+        self.download_output(
+            job_number, job_password, working_directory=working_directory
+        )
+
+        if not os.path.exists(os.path.join(working_directory, "output.gdx")):
+            log_path = os.path.join(working_directory, "solve.log")
+            raise GamspyException(
+                "The job was not completed successfully. Check"
+                f" {log_path} for details."
+            )
+
     def print_queue(self):
         """Prints NEOS Server queue"""
         if not self.is_alive():
@@ -397,6 +453,8 @@ class NeosClient:
 
 
 class NEOSServer(backend.Backend):
+    reads_local_files = False
+
     def __init__(
         self,
         container: Container,
@@ -418,10 +476,10 @@ class NEOSServer(backend.Backend):
 
     def solve(self, is_implicit: bool = False, keep_flags: bool = False):
         # Generate gams string and write modified symbols to gdx
-        gams_string, dirty_names = self.preprocess(keep_flags)
+        gms_path, dirty_names = self.preprocess(keep_flags)
 
         # Run the model
-        self.run(gams_string)
+        self.run(gms_path)
 
         if self.is_async():
             return None
@@ -431,7 +489,11 @@ class NEOSServer(backend.Backend):
 
         return summary
 
-    def run(self, gams_string: str):
+    def run(self, gms_path: str):
+        # NEOS expects the model inline in the job document
+        with open(gms_path) as file:
+            gams_string = file.read()
+
         self.client._prepare_xml(
             gams_string,
             self.container._gdx_in,
@@ -440,18 +502,21 @@ class NEOSServer(backend.Backend):
             options=self.options,
             working_directory=self.container.working_directory,
         )
-        job_number, job_password = self.client.submit_job(
-            is_blocking=self.client.is_blocking,
-            working_directory=self.container.working_directory,
-        )
 
-        if self.client.is_blocking:
-            self.client.download_output(
-                job_number,
-                job_password,
+        with self.measure("gams"):
+            job_number, job_password = self.client.submit_job(
+                is_blocking=self.client.is_blocking,
                 working_directory=self.container.working_directory,
             )
 
+            if self.client.is_blocking:
+                self.client.download_output(
+                    job_number,
+                    job_password,
+                    working_directory=self.container.working_directory,
+                )
+
+        if self.client.is_blocking:
             shutil.move(
                 os.path.join(self.container.working_directory, "output.gdx"),
                 self.container._gdx_out,
@@ -464,14 +529,10 @@ class NEOSServer(backend.Backend):
                     " details."
                 )
 
-        self.container._unsaved_statements = []
-        self.container._delete_autogenerated_symbols()
+        self.clean_up()
 
     def postprocess(self, dirty_names: list[str], is_implicit: bool = False):
-        self.container.loadRecordsFromGdx(
-            self.container._gdx_out,
-            dirty_names + self.container._import_symbols,
-        )
+        self.load_records(dirty_names)
         self.container._swap_checkpoints()
 
         if (
@@ -484,3 +545,186 @@ class NEOSServer(backend.Backend):
             )
 
         return None
+
+
+class NeosJobPool:
+    """
+    Solves models on NEOS Server with many jobs at the same time. Each job
+    is staged in its own directory and restarts from the state of the
+    container when it was submitted. The status of the jobs is polled in
+    the background and their results are collected as they finish.
+
+    Parameters
+    ----------
+    client : NeosClient
+    workers : int, optional
+        Maximum number of jobs that run on NEOS Server at the same time, by
+        default 8
+    poll_interval : float, optional
+        Seconds between two status checks of a job, by default 5
+
+    Examples
+    --------
+    >>> pool = NeosJobPool(client) # doctest: +SKIP
+    >>> for value in [300, 325, 350]: # doctest: +SKIP
+    ...     pool.submit(transport, {demand: [("new-york", value)]})
+    >>> for future in pool.as_completed(): # doctest: +SKIP
+    ...     print(future.result().objective_value)
+    >>> pool.shutdown() # doctest: +SKIP
+
+    """
+
+    def __init__(
+        self,
+        client: NeosClient,
+        workers: int = 8,
+        poll_interval: float = 5.0,
+    ) -> None:
+        if workers < 1:
+            raise ValidationError("`workers` must be a positive integer")
+
+        self.client = client
+        self.poll_interval = poll_interval
+        self._executor = ThreadPoolExecutor(max_workers=workers)
+        self._futures: list[Future] = []
+        # Results are set to the containers by the threads of the jobs
+        self._load_lock = threading.Lock()
+
+    def __enter__(self) -> NeosJobPool:
+        return self
+
+    def __exit__(self, *args) -> None:
+        self.shutdown()
+
+    def submit(
+        self,
+        model: Model,
+        scenario: dict[Parameter, Any] | None = None,
+        solver: str | None = None,
+        options: Options | None = None,
+        load_symbols: list[Set | Parameter | Variable | Equation]
+        | None = None,
+        load_results: bool = False,
+    ) -> Future:
+        """
+        Submits a solve of the model to NEOS Server without waiting for it.
+
+        Parameters
+        ----------
+        model : Model
+        scenario : dict[Parameter, Any], optional
+            Records of the parameters that differ from the container for
+            this job. Records of the container are not changed.
+        solver : str, optional
+            Solver name
+        options : Options, optional
+            GAMS options
+        load_symbols : List[Set | Parameter | Variable | Equation], optional
+            Symbols whose records are collected. By default, records of the
+            variables and equations of the model.
+        load_results : bool, optional
+            Sets the collected records to the symbols of the container
+            before the future of the job is done, by default False
+
+        Returns
+        -------
+        Future
+            Future of the ScenarioResult of the job
+
+        Raises
+        ------
+        ValidationError
+            In case the model is frozen.
+        """
+        from gamspy._backend.batch import Batch
+
+        if model._is_frozen:
+            raise ValidationError("Frozen models cannot be solved on a pool.")
+
+        gams_options = model._prepare_gams_options(solver, "neos", options)
+        runner = Batch(
+            model,
+            gams_options,
+            "neos",
+            load_symbols=(
+                None
+                if load_symbols is None
+                else [symbol.name for symbol in load_symbols]
+            ),
+            neos_client=self.client,
+            poll_interval=self.poll_interval,
+        )
+
+        runner.prepare_checkpoint()
+        job = runner.preprocess_scenario(scenario or {}, None)
+
+        def solve() -> ScenarioResult:
+            result = runner.solve_scenario(job)
+            if load_results:
+                self._load(result, model.container)
+
+            return result
+
+        try:
+            future = self._executor.submit(solve)
+        except RuntimeError:
+            runner.clean_up_scenario(job)
+            raise
+
+        self._futures.append(future)
+
+        return future
+
+    def as_completed(self, timeout: float | None = None) -> Iterator[Future]:
+        """
+        Yields the futures of the submitted jobs as they finish.
+
+        Parameters
+        ----------
+        timeout : float, optional
+            Seconds to wait for all jobs, by default no limit
+
+        Returns
+        -------
+        Iterator[Future]
+        """
+        futures, self._futures = self._futures, []
+        yield from as_completed(futures, timeout)
+
+    def wait(self) -> list[ScenarioResult]:
+        """
+        Waits for all submitted jobs and returns their results in the order
+        of submission.
+
+        Returns
+        -------
+        list[ScenarioResult]
+
+        Raises
+        ------
+        GamspyException
+            In case one of the jobs fails.
+        """
+        futures, self._futures = self._futures, []
+        results = []
+        for future in futures:
+            results.append(future.result())
+
+        return results
+
+    def shutdown(self, wait: bool = True) -> None:
+        """
+        Stops accepting jobs and waits for the running ones unless wait is
+        False.
+
+        Parameters
+        ----------
+        wait : bool, optional
+        """
+        self._executor.shutdown(wait=wait)
+
+    def _load(self, result: ScenarioResult, container: Container) -> None:
+        # Jobs of the same container finish in different threads
+        with self._load_lock:
+            for name, records in result.records.items():
+                container[name].setRecords(records)
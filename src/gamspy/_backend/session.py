@@ -0,0 +1,217 @@
+#
+# GAMS - General Algebraic Modeling System Python API
+#
+# Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+# Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+from __future__ import annotations
+
+import os
+from typing import TYPE_CHECKING
+
+from gams import GamsOptions
+from gams.core import gamsx
+from gams.core import opt
+
+from gamspy._backend.local import Local
+from gamspy.exceptions import _get_error_message
+from gamspy.exceptions import error_codes
+from gamspy.exceptions import GamspyException
+
+if TYPE_CHECKING:
+    import io
+    from gamspy import Container
+
+
+class GamsSession:
+    """
+    Keeps the GAMS execution library and an option handle loaded in the
+    current process so that consecutive runs do not spawn a new GAMS
+    process each time. Only the startup of the process is saved; the state
+    of the model is still passed from run to run through the save and
+    restart checkpoints.
+
+    Parameters
+    ----------
+    system_directory : str
+        Path to the GAMS installation
+    """
+
+    def __init__(self, system_directory: str):
+        self.system_directory = system_directory
+        self._gamsx_handle = None
+        self._opt_handle = None
+
+        gamsx_handle = gamsx.new_gamsxHandle_tp()
+        is_created, message = gamsx.gamsxCreateD(
+            gamsx_handle, system_directory, gamsx.GMS_SSSIZE
+        )
+        if not is_created:
+            raise GamspyException(
+                f"Could not load the GAMS execution library: {message}"
+            )
+        self._gamsx_handle = gamsx_handle
+
+        opt_handle = opt.new_optHandle_tp()
+        is_created, message = opt.optCreateD(
+            opt_handle, system_directory, opt.GMS_SSSIZE
+        )
+        if not is_created:
+            raise GamspyException(
+                f"Could not load the option library: {message}"
+            )
+        self._opt_handle = opt_handle
+
+        if opt.optReadDefinition(
+            opt_handle, os.path.join(system_directory, "optgams.def")
+        ):
+            raise GamspyException("Could not read the GAMS option definitions")
+
+    def run(
+        self,
+        input_file: str,
+        parameter_file: str,
+        working_directory: str,
+        save_to: str,
+        restart_from: str | None = None,
+    ) -> int:
+        """
+        Executes the given GAMS file in the current process.
+
+        Parameters
+        ----------
+        input_file : str
+            Path to the .gms file
+        parameter_file : str
+            Path to the parameter file that holds the GAMS options
+        working_directory : str
+            Current directory of the run
+        save_to : str
+            Path of the checkpoint file to save the work file to
+        restart_from : str, optional
+            Path of the checkpoint file to restart from
+
+        Returns
+        -------
+        int
+            Return code of the GAMS run
+        """
+        opt_handle = self._opt_handle
+        opt.optResetAll(opt_handle)
+        opt.optReadParameterFile(opt_handle, parameter_file)
+
+        opt.optSetStrStr(opt_handle, "SysDir", self.system_directory)
+        opt.optSetStrStr(opt_handle, "Input", input_file)
+        opt.optSetStrStr(opt_handle, "CurDir", working_directory)
+        opt.optSetStrStr(opt_handle, "Save", save_to)
+        if restart_from is not None:
+            opt.optSetStrStr(opt_handle, "Restart", restart_from)
+
+        return_code, message = gamsx.gamsxRunExecDLL(
+            self._gamsx_handle, opt_handle, self.system_directory, 1
+        )
+
+        if return_code not in error_codes and return_code != 0:
+            raise GamspyException(
+                f"Could not execute the GAMS session: {message}"
+            )
+
+        return return_code
+
+    def close(self):
+        """Releases the GAMS libraries kept by the session."""
+        if self._opt_handle is not None:
+            opt.optFree(self._opt_handle)
+            self._opt_handle = None
+
+        if self._gamsx_handle is not None:
+            gamsx.gamsxFree(self._gamsx_handle)
+            self._gamsx_handle = None
+
+    def __del__(self):
+        self.close()
+
+
+class Session(Local):
+    def __init__(
+        self,
+        container: Container,
+        options: GamsOptions,
+        output: io.TextIOWrapper | None = None,
+    ) -> None:
+        super().__init__(container, options, output)
+
+    def run(self, gms_path: str):
+        if self.container._session is None:
+            self.container._session = GamsSession(
+                self.container.system_directory
+            )
+
+        working_directory = self.container.working_directory
+        job_name = self.job_name
+        input_file = gms_path
+        parameter_file = os.path.join(working_directory, job_name + ".pf")
+        log_file = os.path.join(working_directory, job_name + ".log")
+
+        # The session runs inside the current process. Hence, the log can
+        # only be redirected through a log file. The options of the run are
+        # copied since they might be shared with other runs.
+        options = GamsOptions(self.container.workspace, opt_from=self.options)
+        if self.output is not None:
+            options._logoption = 2
+            options.logfile = log_file
+
+        options.export(parameter_file)
+
+        restart_from = None
+        if os.path.exists(self.container._restart_from._checkpoint_file_name):
+            restart_from = self.container._restart_from._checkpoint_file_name
+
+        try:
+            with self.measure("gams"):
+                return_code = self.container._session.run(
+                    input_file,
+                    parameter_file,
+                    working_directory,
+                    self.container._save_to._checkpoint_file_name,
+                    restart_from,
+                )
+
+            if self.output is not None and os.path.exists(log_file):
+                with open(log_file) as file:
+                    self.output.write(file.read())
+
+            if return_code != 0:
+                lst_filename = (
+                    options.output if options.output else job_name + ".lst"
+                )
+                raise GamspyException(
+                    _get_error_message(
+                        os.path.join(working_directory, lst_filename),
+                        return_code,
+                    )
+                )
+        finally:
+            self.clean_up()
+
+            for path in (parameter_file, log_file):
+                if os.path.exists(path):
+                    os.remove(path)
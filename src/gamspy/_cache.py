@@ -0,0 +1,189 @@
+#
+# GAMS - General Algebraic Modeling System Python API
+#
+# Copyright (c) 2023 GAMS Development Corp. <support@gams.com>
+# Copyright (c) 2023 GAMS Software GmbH <support@gams.com>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+from __future__ import annotations
+
+import io
+import os
+import time
+import uuid
+import zipfile
+from abc import ABC
+from abc import abstractmethod
+
+import pandas as pd
+
+from gamspy.exceptions import ValidationError
+
+# Names of the files in a cache entry
+RESULTS_FILE = "results.gdx"
+SUMMARY_FILE = "summary.json"
+
+
+class SolveCache(ABC):
+    """
+    Base class of the stores of solve results. A store keeps the entries
+    as bytes by key. Keys start with the name of the model followed by a
+    dash so that the entries of a model can be invalidated together.
+    Subclasses can keep the entries in any storage such as a database or a
+    key-value store.
+    """
+
+    @abstractmethod
+    def get(self, key: str) -> bytes | None:
+        """
+        Returns the entry of the given key or None if there is no entry.
+
+        Parameters
+        ----------
+        key : str
+
+        Returns
+        -------
+        bytes | None
+        """
+
+    @abstractmethod
+    def put(self, key: str, entry: bytes) -> None:
+        """
+        Stores the entry under the given key.
+
+        Parameters
+        ----------
+        key : str
+        entry : bytes
+        """
+
+    @abstractmethod
+    def invalidate(self, model_name: str | None = None) -> None:
+        """
+        Removes the entries of the given model or all entries if no
+        model name is given.
+
+        Parameters
+        ----------
+        model_name : str, optional
+        """
+
+
+class DiskCache(SolveCache):
+    """
+    Keeps the solve results in a directory. The directory can be shared by
+    several processes or machines since the entries are written to a
+    temporary file first and then renamed.
+
+    Parameters
+    ----------
+    directory : str
+        Directory of the entries. It is created if it does not exist.
+    max_age : float, optional
+        Entries that are older than max_age seconds are removed instead of
+        being returned. By default, entries never expire.
+
+    Examples
+    --------
+    >>> import gamspy as gp
+    >>> cache = gp.DiskCache("solve_cache")
+    >>> transport.solve(cache=cache) # doctest: +SKIP
+    >>> cache.invalidate("transport")
+
+    """
+
+    def __init__(self, directory: str, max_age: float | None = None):
+        if max_age is not None and max_age <= 0:
+            raise ValidationError("`max_age` must be a positive number")
+
+        self.directory = os.path.abspath(directory)
+        self.max_age = max_age
+        os.makedirs(self.directory, exist_ok=True)
+
+    def _get_path(self, key: str) -> str:
+        return os.path.join(self.directory, key + ".zip")
+
+    def get(self, key: str) -> bytes | None:
+        path = self._get_path(key)
+
+        try:
+            if (
+                self.max_age is not None
+                and time.time() - os.path.getmtime(path) > self.max_age
+            ):
+                os.remove(path)
+                return None
+
+            with open(path, "rb") as file:
+                return file.read()
+        except FileNotFoundError:
+            # Another process might have removed the entry in between
+            return None
+
+    def put(self, key: str, entry: bytes) -> None:
+        temp_path = os.path.join(self.directory, f".{uuid.uuid4()}.tmp")
+        with open(temp_path, "wb") as file:
+            file.write(entry)
+
+        os.replace(temp_path, self._get_path(key))
+
+    def invalidate(self, model_name: str | None = None) -> None:
+        for file_name in os.listdir(self.directory):
+            if not file_name.endswith(".zip"):
+                continue
+
+            if model_name is None or file_name.startswith(model_name + "-"):
+                try:
+                    os.remove(os.path.join(self.directory, file_name))
+                except FileNotFoundError:
+                    pass
+
+
+def _pack_entry(gdx_path: str, summary: pd.DataFrame | None) -> bytes:
+    """Packs the results gdx file and the summary of a solve"""
+    buffer = io.BytesIO()
+    with zipfile.ZipFile(buffer, "w", zipfile.ZIP_DEFLATED) as archive:
+        archive.write(gdx_path, RESULTS_FILE)
+
+        if summary is not None:
+            archive.writestr(SUMMARY_FILE, summary.to_json(orient="split"))
+
+    return buffer.getvalue()
+
+
+def _unpack_entry(entry: bytes, gdx_path: str) -> pd.DataFrame | None:
+    """
+    Writes the results of the entry to the given gdx path and returns the
+    summary of the solve.
+    """
+    with zipfile.ZipFile(io.BytesIO(entry)) as archive:
+        with open(gdx_path, "wb") as file:
+            file.write(archive.read(RESULTS_FILE))
+
+        if SUMMARY_FILE not in archive.namelist():
+            return None
+
+        return pd.read_json(
+            io.StringIO(archive.read(SUMMARY_FILE).decode()),
+            orient="split",
+            dtype=False,
+            convert_dates=False,
+        )
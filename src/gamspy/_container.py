@@ -24,10 +24,14 @@
 #
 from __future__ import annotations
 
+import io
 import os
-import shutil
+import threading
 import uuid
+from concurrent.futures import Future
+from concurrent.futures import ThreadPoolExecutor
 from typing import Any
+from typing import Callable
 from typing import Literal
 from typing import TYPE_CHECKING
 
@@ -40,6 +44,7 @@ from gams import GamsWorkspace
 from gams.core import gdx
 
 import gamspy as gp
+import gamspy._validation as validation
 import gamspy.utils as utils
 from gamspy._backend.backend import backend_factory
 from gamspy._options import _map_options
@@ -56,9 +61,52 @@ if TYPE_CHECKING:
         Model,
     )
     from gamspy._algebra.expression import Expression
+    from gamspy._backend.backend import Backend
+    from gamspy._symbols.symbol import Symbol
+    from gamspy._backend.session import GamsSession
     from gamspy._options import Options
 
 
+class _DeclarationBlock:
+    """
+    Declarations of the symbols that are added together by addSymbols.
+    Consecutive symbols of the same kind are declared in one statement.
+    """
+
+    def __init__(self) -> None:
+        self.symbols: list[Set | Parameter | Variable | Equation] = []
+
+    def getStatement(self) -> str:
+        lines: list[str] = []
+        current_keyword = None
+        for symbol in self.symbols:
+            # e.g. "Singleton Set s" and "positive Variable x(i)"
+            num_keywords = 1
+            if isinstance(symbol, gp.Variable) or (
+                isinstance(symbol, gp.Set) and symbol.is_singleton
+            ):
+                num_keywords = 2
+
+            *keywords, declaration = symbol.getStatement()[:-1].split(
+                " ", num_keywords
+            )
+            keyword = " ".join(keywords)
+
+            if keyword == current_keyword:
+                lines[-1] += ","
+                lines.append(f"    {declaration}")
+            else:
+                if lines:
+                    lines[-1] += ";"
+                lines.append(f"{keyword} {declaration}")
+                current_keyword = keyword
+
+        if lines:
+            lines[-1] += ";"
+
+        return "\n".join(lines)
+
+
 class Container(gt.Container):
     """
     A container is an object that holds all symbols and operates on them.
@@ -76,6 +124,25 @@ class Container(gt.Container):
         Delayed execution mode, by default False
     options : Options
         Global options for the overall execution
+    backend : str, optional
+        Backend to run the implicit executions such as assignments on,
+        by default "local". "session" keeps GAMS loaded in the current
+        process between executions instead of starting a new GAMS process
+        for each of them. This saves only the process startup since the
+        state is still passed between executions through checkpoints.
+    timing_callback : Callable[[str, float, dict], None], optional
+        Function that is called with the name, the duration in seconds and
+        the attributes of each phase of a run (e.g. "validation",
+        "gdx_write", "generation", "gams", "gdx_read"), by default None
+    strict_validation : bool, optional
+        Validates all symbols of the container before each run instead of
+        only the symbols that were modified since the last run, by default
+        False
+    local_evaluation : bool, optional
+        Evaluates parameter assignments with arithmetic, conditions and
+        sum, prod, smin and smax operations in NumPy instead of running
+        GAMS. Assignments that cannot be evaluated locally are run by GAMS
+        as usual, by default False
 
     Examples
     --------
@@ -92,7 +159,17 @@ class Container(gt.Container):
         working_directory: str | None = None,
         delayed_execution: bool = False,
         options: Options | None = None,
+        backend: Literal["local", "session"] = "local",
+        timing_callback: Callable[[str, float, dict], None] | None = None,
+        strict_validation: bool = False,
+        local_evaluation: bool = False,
     ):
+        if backend not in ["local", "session"]:
+            raise ValidationError(
+                "Implicit executions can only run on `local` or `session`"
+                f" backends but found `{backend}`"
+            )
+
         system_directory = (
             system_directory
             if system_directory
@@ -100,12 +177,45 @@ class Container(gt.Container):
         )
 
         self._delayed_execution = delayed_execution
+        self._timing_callback = timing_callback
+        self._strict_validation = strict_validation
+        self._local_evaluation = local_evaluation
         self._unsaved_statements: list = []
+
+        # collects the declarations of addSymbols while it creates symbols
+        # and whether their names are validated already
+        self._declaration_block: _DeclarationBlock | None = None
+        self._are_names_validated = False
+
+        # symbols whose state must be synchronized with GAMS, keyed by id
+        self._dirty_symbols: dict[int, Symbol] = {}
+        self._modified_symbols: dict[int, Symbol] = {}
+        self._autogenerated_symbols: dict[int, Symbol] = {}
+
+        # symbols whose records are still in a gdx file: name -> (symbol, path)
+        self._deferred_symbols: dict[str, tuple[Symbol, str]] = {}
+
+        # categories of the label columns that are shared by the records of
+        # all symbols: (size, first label, last label) -> dtypes
+        self._label_store: dict[tuple, list[pd.CategoricalDtype]] = {}
+
+        # reusable container to read records of existing symbols from gdx
+        self._load_container: gt.Container | None = None
+
+        # solve that runs in the background and the symbols it changes
+        self._executor: ThreadPoolExecutor | None = None
+        self._executor_thread_id: int | None = None
+        self._pending_run: Future | None = None
+        self._pending_symbols: set[str] = set()
         self._is_first_run = True
 
         # import symbols from arbitrary gams code
         self._import_symbols: list[str] = []
 
+        # solve statements of compiled models -> model attributes that are
+        # declared in GAMS and unloaded by the runs with that solve
+        self._compiled_solves: dict[str, list[str]] = {}
+
         super().__init__(load_from, system_directory)
 
         self.workspace = GamsWorkspace(
@@ -123,6 +233,14 @@ class Container(gt.Container):
 
         self._job: GamsJob | None = None
         self._options = options
+        self._backend = backend
+        self._session: GamsSession | None = None
+
+    def __del__(self):
+        # Stops the thread of the background solves
+        executor = getattr(self, "_executor", None)
+        if executor is not None:
+            executor.shutdown(wait=False)
 
     def _addGamsCode(self, gams_code: str, import_symbols: list[str] = []):
         if import_symbols is not None and (
@@ -135,87 +253,257 @@ class Container(gt.Container):
         self._unsaved_statements.append(gams_code)
 
     def _add_statement(self, statement) -> None:
-        self._unsaved_statements.append(statement)
+        block = self._declaration_block
+        if block is not None:
+            if isinstance(
+                statement, (gp.Set, gp.Parameter, gp.Variable, gp.Equation)
+            ):
+                if not block.symbols:
+                    self._unsaved_statements.append(block)
+
+                block.symbols.append(statement)
+                return
+
+            # Symbols that are declared after this statement, e.g. after
+            # the definition of an equation, go to a new block
+            if block.symbols:
+                self._declaration_block = _DeclarationBlock()
 
-    def _assign_symbol_attributes(
-        self,
-        gp_symbol: Set | Parameter | Variable | Equation,
-        gtp_symbol: gt.Set | gt.Parameter | gt.Variable | gt.Equation,
-    ):
-        gp_symbol._records = gtp_symbol._records
-        gp_symbol._domain_forwarding = gtp_symbol._domain_forwarding
-        gp_symbol._description = gtp_symbol._description
+        self._unsaved_statements.append(statement)
 
     def _cast_symbols(self, symbol_names: list[str] | None = None) -> None:
-        """Casts GTP symbols to GAMSpy symbols"""
+        """
+        Casts GTP symbols to GAMSpy symbols. The GTP symbols are adopted as
+        they are, so their records and domains are not rebuilt.
+        """
+        CAST_TYPES = [
+            (gt.Alias, gp.Alias),
+            (gt.UniverseAlias, gp.UniverseAlias),
+            (gt.Set, gp.Set),
+            (gt.Parameter, gp.Parameter),
+            (gt.Variable, gp.Variable),
+            (gt.Equation, gp.Equation),
+        ]
+        GAMSPY_TYPES = tuple(gp_type for _, gp_type in CAST_TYPES)
+
         symbol_names = symbol_names if symbol_names else list(self.data.keys())
 
         for symbol_name in symbol_names:
-            gtp_symbol = self.data[symbol_name]
-            new_domain = [
-                (
-                    self.data[member.name]
-                    if not isinstance(member, str)
-                    else member
-                )
-                for member in gtp_symbol.domain
-            ]
+            symbol = self.data[symbol_name]
+            if isinstance(symbol, GAMSPY_TYPES):
+                continue
 
-            del self.data[symbol_name]
+            for gt_type, gp_type in CAST_TYPES:
+                if isinstance(symbol, gt_type):
+                    symbol.__class__ = gp_type
+                    symbol._adopt()
+                    break
 
-            if isinstance(gtp_symbol, gt.Alias):
-                alias_with = self.data[gtp_symbol.alias_with.name]
-                _ = gp.Alias(
-                    self,
-                    gtp_symbol.name,
-                    alias_with,
-                )
-            elif isinstance(gtp_symbol, gt.UniverseAlias):
-                _ = gp.UniverseAlias(
-                    self,
-                    gtp_symbol.name,
-                )
-            elif isinstance(gtp_symbol, gt.Set):
-                gp_symbol = gp.Set(self, gtp_symbol.name, domain=new_domain)
-
-                gp_symbol._is_singleton = gtp_symbol.is_singleton
-                self._assign_symbol_attributes(gp_symbol, gtp_symbol)
-            elif isinstance(gtp_symbol, gt.Parameter):
-                gp_symbol = gp.Parameter(
-                    self, gtp_symbol.name, domain=new_domain
-                )
-                self._assign_symbol_attributes(gp_symbol, gtp_symbol)
-            elif isinstance(gtp_symbol, gt.Variable):
-                gp_symbol = gp.Variable(
-                    self, gtp_symbol.name, gtp_symbol.type, domain=new_domain
-                )
-                self._assign_symbol_attributes(gp_symbol, gtp_symbol)
-            elif isinstance(gtp_symbol, gt.Equation):
-                symbol_type = gtp_symbol.type
-                if gtp_symbol.type in ["eq", "leq", "geq"]:
-                    symbol_type = "regular"
-                gp_symbol = gp.Equation(
-                    container=self,
-                    name=gtp_symbol.name,
-                    type=symbol_type,
-                    domain=new_domain,
-                )
-                self._assign_symbol_attributes(gp_symbol, gtp_symbol)
+    def _share_labels(self, symbol_names: list[str] | None = None) -> None:
+        """
+        Makes the label columns of the given symbols use the categories of
+        the label store. Columns with the same labels then keep only their
+        integer codes and share a single copy of the labels. If no symbol
+        names are given, all symbols are processed.
+        """
+        symbol_names = symbol_names if symbol_names else list(self.data.keys())
+
+        for name in symbol_names:
+            symbol = self.data.get(name)
+            if symbol is None or isinstance(
+                symbol, (gt.Alias, gt.UniverseAlias)
+            ):
+                continue
+
+            records = symbol._records
+            if records is None:
+                continue
+
+            for column in records.columns[: symbol.dimension]:
+                labels = records[column]
+                if not isinstance(labels.dtype, pd.CategoricalDtype):
+                    continue
+
+                dtype = self._get_shared_dtype(labels.dtype)
+                if dtype is not labels.dtype:
+                    records[column] = pd.Categorical.from_codes(
+                        labels.cat.codes, dtype=dtype
+                    )
+
+    def _get_shared_dtype(
+        self, dtype: pd.CategoricalDtype
+    ) -> pd.CategoricalDtype:
+        MAX_DTYPES_PER_KEY = 8
+
+        categories = dtype.categories
+        if len(categories) == 0:
+            return dtype
 
-    def _delete_autogenerated_symbols(self):
+        key = (len(categories), categories[0], categories[-1])
+        candidates = self._label_store.setdefault(key, [])
+        for candidate in candidates:
+            if candidate is dtype or (
+                candidate.ordered == dtype.ordered
+                and candidate.categories.equals(categories)
+            ):
+                return candidate
+
+        candidates.append(dtype)
+        if len(candidates) > MAX_DTYPES_PER_KEY:
+            candidates.pop(0)
+
+        return dtype
+
+    def _delete_autogenerated_symbols(
+        self, symbol_ids: list[int] | None = None
+    ):
         """
-        Removes autogenerated model attributes, objective variable and equation from
-        the container
+        Removes autogenerated model attributes, objective variable and
+        equation from the container. If no symbol ids are given, all
+        autogenerated symbols are removed.
         """
-        autogenerated_symbol_names = [
-            name
-            for name in self.data.keys()
-            if gp.Model._generate_prefix in name
-        ]
+        if symbol_ids is None:
+            symbol_ids = list(self._autogenerated_symbols.keys())
+
+        symbols = {
+            symbol_id: self._autogenerated_symbols.pop(symbol_id)
+            for symbol_id in symbol_ids
+            if symbol_id in self._autogenerated_symbols
+        }
+
+        for name in self._get_tracked_names(symbols):
+            del self.data[name]
+
+    def _track_symbol(self, symbol: Symbol) -> None:
+        self._update_dirty_state(symbol)
+        self._update_modified_state(symbol)
+
+        if symbol.name.startswith(gp.Model._generate_prefix):
+            self._autogenerated_symbols[id(symbol)] = symbol
+
+    def _update_dirty_state(self, symbol: Symbol) -> None:
+        if symbol._is_dirty:
+            self._dirty_symbols[id(symbol)] = symbol
+        else:
+            self._dirty_symbols.pop(id(symbol), None)
+
+    def _update_modified_state(self, symbol: Symbol) -> None:
+        if symbol.modified:
+            self._modified_symbols[id(symbol)] = symbol
+        else:
+            self._modified_symbols.pop(id(symbol), None)
+
+    def _defer_records(self, symbol_names: list[str], load_from: str) -> None:
+        """
+        Leaves the records of the given symbols in the gdx file until they
+        are accessed.
+        """
+        replaced_paths = set()
+        for name in symbol_names:
+            symbol = self[name]
+            if name in self._deferred_symbols:
+                replaced_paths.add(self._deferred_symbols[name][1])
 
-        for name in autogenerated_symbol_names:
-            if name in self.data.keys():
-                del self.data[name]
+            self._deferred_symbols[name] = (symbol, load_from)
+
+            # GAMS has records that differ from the last synchronized ones,
+            # so the next write of the symbol must not be a delta
+            if hasattr(symbol, "_synced_records"):
+                symbol._synced_records = None
+
+        self._remove_unreferenced_files(replaced_paths)
+
+    def _drop_deferred_records(self, symbol_name: str) -> None:
+        """
+        Forgets the deferred records of a symbol whose records are replaced
+        and removes the preserved gdx file if nothing refers to it anymore.
+        """
+        deferred = self._deferred_symbols.pop(symbol_name, None)
+        if deferred is not None:
+            self._remove_unreferenced_files({deferred[1]})
+
+    def _remove_unreferenced_files(self, paths: set[str]) -> None:
+        """Removes the preserved gdx files that no deferred symbol needs"""
+        referenced_paths = {
+            path for _, path in self._deferred_symbols.values()
+        }
+        for path in paths:
+            if (
+                path not in referenced_paths
+                and path != self._gdx_out
+                and os.path.exists(path)
+            ):
+                os.remove(path)
+
+    def _preserve_deferred_records(self) -> None:
+        """
+        Moves the output gdx file aside if it holds deferred records since
+        the next run overwrites it.
+        """
+        deferred_paths = [path for _, path in self._deferred_symbols.values()]
+        if self._gdx_out not in deferred_paths:
+            return
+
+        preserved_path = os.path.join(
+            self.working_directory, f"_gdx_deferred_{uuid.uuid4()}.gdx"
+        )
+        os.replace(self._gdx_out, preserved_path)
+
+        for name, (symbol, path) in self._deferred_symbols.items():
+            if path == self._gdx_out:
+                self._deferred_symbols[name] = (symbol, preserved_path)
+
+    def _load_deferred_records(
+        self, symbol_names: list[str] | None = None
+    ) -> None:
+        """
+        Loads the deferred records of the given symbols. If no symbol names
+        are given, all deferred records are loaded.
+        """
+        if symbol_names is None:
+            symbol_names = list(self._deferred_symbols.keys())
+
+        paths: dict[str, list[str]] = {}
+        removed_paths = set()
+        for name in symbol_names:
+            if name not in self._deferred_symbols:
+                continue
+
+            symbol, path = self._deferred_symbols[name]
+            try:
+                is_member = self.data[name] is symbol
+            except KeyError:
+                is_member = False
+
+            if is_member:
+                paths.setdefault(path, []).append(name)
+            else:
+                del self._deferred_symbols[name]
+                removed_paths.add(path)
+
+        for path, names in paths.items():
+            self.loadRecordsFromGdx(path, names)
+
+        self._remove_unreferenced_files(removed_paths)
+
+    def _get_tracked_names(self, symbols: dict[int, Symbol]) -> list[str]:
+        """
+        Returns the names of the tracked symbols that are still in the
+        container and stops tracking the ones that were removed.
+        """
+        names = []
+        for key, symbol in list(symbols.items()):
+            try:
+                is_member = self.data[symbol.name] is symbol
+            except KeyError:
+                is_member = False
+
+            if is_member:
+                names.append(symbol.name)
+            else:
+                del symbols[key]
+
+        return names
 
     def _get_symbol_names_from_gdx(self, load_from: str) -> list[str]:
         gdx_handle = utils._open_gdx_file(self.system_directory, load_from)
@@ -230,6 +518,18 @@ class Container(gt.Container):
 
         return symbol_names
 
+    def _get_load_container(self) -> gt.Container:
+        """
+        Returns the container that is reused to read the records of the
+        existing symbols from gdx files.
+        """
+        if self._load_container is None:
+            self._load_container = gt.Container(
+                system_directory=self.system_directory
+            )
+
+        return self._load_container
+
     def _get_symbol_names_to_load(
         self,
         load_from: str,
@@ -250,37 +550,124 @@ class Container(gt.Container):
         return save_to, restart_from, gdx_in, gdx_out
 
     def _get_autogenerated_symbol_names(self) -> list[str]:
-        names = []
-        for name in self.data.keys():
-            if name.startswith(gp.Model._generate_prefix):
-                names.append(name)
+        return self._get_tracked_names(self._autogenerated_symbols)
 
-        return names
+    def _validate_symbols(self, modified_names: list[str]) -> None:
+        """
+        Validates the symbols that were modified since the last run. In
+        strict validation mode, all symbols of the container are validated.
+        """
+        if self._strict_validation:
+            self.isValid(verbose=True, force=True)
+            return
+
+        for name in modified_names:
+            self[name].isValid(verbose=True, force=True)
 
     def _get_touched_symbol_names(self) -> tuple[list[str], list[str]]:
-        dirty_names = []
-        modified_names = []
+        dirty_names = self._get_tracked_names(self._dirty_symbols)
+        modified_names = self._get_tracked_names(self._modified_symbols)
 
-        for name, symbol in self:
-            if isinstance(symbol, gp.UniverseAlias):
-                continue
+        return dirty_names, modified_names
 
-            if symbol._is_dirty:
-                dirty_names.append(name)
+    def _submit_run(
+        self, runner: Backend, on_completion: Callable | None = None
+    ) -> Future:
+        """
+        Generates the GAMS code in the calling thread and runs it in the
+        background. The records of the changed symbols are loaded before
+        the returned future is completed.
+        """
+        gms_path, dirty_names = runner.preprocess()
+        self._pending_symbols = set(dirty_names)
 
-            if symbol.modified:
-                modified_names.append(name)
+        def run_in_background():
+            self._executor_thread_id = threading.get_ident()
 
-        return dirty_names, modified_names
+            try:
+                runner.run(gms_path)
+                summary = runner.postprocess(dirty_names)
+            except Exception:
+                # GAMS still has to send the records of these symbols
+                for name in dirty_names:
+                    if name in self:
+                        self[name]._is_dirty = True
+
+                raise
+            finally:
+                self._pending_symbols = set()
+
+            if on_completion is not None:
+                on_completion()
+
+            return summary
+
+        if self._executor is None:
+            self._executor = ThreadPoolExecutor(max_workers=1)
+
+        self._pending_run = self._executor.submit(run_in_background)
+
+        return self._pending_run
+
+    def _detach_shared_files(self) -> None:
+        """
+        Detaches the files that a run overwrites from the containers that
+        share them after a copy.
+        """
+        for path in (
+            self._save_to._checkpoint_file_name,
+            self._gdx_in,
+            self._gdx_out,
+        ):
+            utils._detach_shared_file(path)
+
+    def _wait_for_pending_run(self) -> None:
+        """
+        Blocks until the solve that runs in the background is completed and
+        raises its exception, if any.
+        """
+        future = self._pending_run
+        if future is None or threading.get_ident() == self._executor_thread_id:
+            return
+
+        self._pending_run = None
+        future.result()
+
+    def _can_evaluate_locally(self) -> bool:
+        """
+        Whether an assignment can be evaluated in Python without changing
+        its order with respect to the statements that are not run yet.
+        Pending declarations do not depend on the records of symbols.
+        """
+        if not self._local_evaluation:
+            return False
+
+        self._wait_for_pending_run()
+
+        return all(
+            isinstance(
+                statement,
+                (
+                    gp.Set,
+                    gp.Alias,
+                    gp.Parameter,
+                    gp.Variable,
+                    gp.Equation,
+                    _DeclarationBlock,
+                ),
+            )
+            for statement in self._unsaved_statements
+        )
 
     def _run(self, keep_flags: bool = False) -> pd.DataFrame | None:
         options = _map_options(
             self.workspace,
+            backend=self._backend,
             global_options=self._options,
             is_seedable=self._is_first_run,
         )
 
-        runner = backend_factory(self, options)
+        runner = backend_factory(self, options, backend=self._backend)
 
         summary = runner.solve(is_implicit=True, keep_flags=keep_flags)
 
@@ -294,47 +681,176 @@ class Container(gt.Container):
     def _get_unload_symbols_str(
         self, dirty_names: list[str], gdx_out: str
     ) -> str:
-        # Write dirty names, import symbols and autogenerated names to gdx
+        # Write dirty names, import symbols, autogenerated names and the
+        # attributes of the compiled models that are solved in this run
         autogenerated_names = self._get_autogenerated_symbol_names()
-        unload_names = dirty_names + autogenerated_names + self._import_symbols
+        compiled_names = [
+            name
+            for statement in self._unsaved_statements
+            if isinstance(statement, str)
+            for name in self._compiled_solves.get(statement, [])
+        ]
+        unload_names = (
+            dirty_names
+            + autogenerated_names
+            + self._import_symbols
+            + list(dict.fromkeys(compiled_names))
+        )
 
         unload_str = ",".join(unload_names)
         return f"execute_unload '{gdx_out}' {unload_str}\n"
 
-    def _generate_gams_string(
+    def _write_modified_symbols(
+        self, write_to: str, modified_names: list[str]
+    ) -> tuple[list[str], list[str], dict[str, list[str]]]:
+        """
+        Writes the modified symbols to the given gdx file. Records of large
+        parameters, variables and equations that GAMS already has are
+        written as delta (only the added and changed records) if no
+        records were removed. Records of parameters that are still in a
+        file are streamed to separate gdx files chunk by chunk.
+
+        Returns
+        -------
+        tuple[list[str], list[str], dict[str, list[str]]]
+            Names of the symbols to be loaded, names of the symbols to be
+            merged into the existing records on the GAMS side and the gdx
+            files of the streamed parameters by symbol name.
+        """
+        DELTA_SYMBOL_TYPES = (gp.Parameter, gp.Variable, gp.Equation)
+
+        declared_ids = set()
+        for statement in self._unsaved_statements:
+            if isinstance(statement, DELTA_SYMBOL_TYPES):
+                declared_ids.add(id(statement))
+            elif isinstance(statement, _DeclarationBlock):
+                declared_ids.update(id(symbol) for symbol in statement.symbols)
+
+        load_names = []
+        deltas = {}
+        stream_files = {}
+        for name in modified_names:
+            symbol = self[name]
+            if (
+                isinstance(symbol, gp.Parameter)
+                and symbol._records_file is not None
+            ):
+                stream_files[name] = symbol._write_records_file(
+                    self.working_directory
+                )
+                continue
+
+            if (
+                isinstance(symbol, DELTA_SYMBOL_TYPES)
+                and symbol.dimension > 0
+                and id(symbol) not in declared_ids
+            ):
+                delta = utils._get_records_delta(
+                    symbol._synced_records, symbol._records, symbol.dimension
+                )
+                if delta is not None:
+                    if len(delta) > 0:
+                        deltas[name] = delta
+
+                    # GAMS already has the records if there is no delta
+                    continue
+
+            load_names.append(name)
+
+        merge_names = list(deltas.keys())
+        records = {name: self[name]._records for name in merge_names}
+        try:
+            for name, delta in deltas.items():
+                self[name]._records = delta
+
+            self.write(write_to, load_names + merge_names)
+        finally:
+            for name, original_records in records.items():
+                self[name]._records = original_records
+
+        for name in modified_names:
+            if isinstance(self[name], DELTA_SYMBOL_TYPES):
+                self[name]._sync_records()
+
+        return load_names, merge_names, stream_files
+
+    def _write_gams_code(
         self,
+        file: io.TextIOBase,
         gdx_in: str,
         gdx_out: str,
         dirty_names: list[str],
         modified_names: list[str],
-    ) -> str:
+        merge_names: list[str] | None = None,
+        stream_files: dict[str, list[str]] | None = None,
+    ) -> None:
+        """
+        Writes the GAMS code of the unsaved statements to the given stream
+        statement by statement.
+        """
+        stream_files = stream_files if stream_files is not None else {}
+
         LOAD_SYMBOL_TYPES = (gp.Set, gp.Parameter, gp.Variable, gp.Equation)
 
-        string = f"$onMultiR\n$onUNDF\n$gdxIn {gdx_in}\n"
+        file.write(f"$onMultiR\n$onUNDF\n$gdxIn {gdx_in}\n")
         for statement in self._unsaved_statements:
             if isinstance(statement, str):
-                string += statement + "\n"
+                file.write(statement + "\n")
             elif isinstance(statement, gp.UniverseAlias):
                 continue
             else:
-                string += statement.getStatement() + "\n"
+                file.write(statement.getStatement() + "\n")
 
-                if (
-                    isinstance(statement, LOAD_SYMBOL_TYPES)
-                    and statement.modified
-                ):
-                    string += f"$load {statement.name}\n"
+                symbols = (
+                    statement.symbols
+                    if isinstance(statement, _DeclarationBlock)
+                    else [statement]
+                )
+                for symbol in symbols:
+                    if (
+                        isinstance(symbol, LOAD_SYMBOL_TYPES)
+                        and symbol.modified
+                        and symbol.name not in stream_files
+                    ):
+                        file.write(f"$load {symbol.name}\n")
 
         for symbol_name in modified_names:
             if not isinstance(
                 self[symbol_name], gp.Alias
             ) and not symbol_name.startswith(gp.Model._generate_prefix):
-                string += f"$load {symbol_name}\n"
+                file.write(f"$load {symbol_name}\n")
+
+        if merge_names is not None:
+            for symbol_name in merge_names:
+                file.write(f"$loadM {symbol_name}\n")
+
+        file.write("$offUNDF\n$gdxIn\n")
+
+        # The first chunk replaces the records, the others are merged
+        for symbol_name, paths in stream_files.items():
+            for idx, path in enumerate(paths):
+                load = "$load" if idx == 0 else "$loadM"
+                file.write(
+                    f"$onMultiR\n$onUNDF\n$gdxIn {path}\n{load}"
+                    f" {symbol_name}\n$offUNDF\n$gdxIn\n"
+                )
 
-        string += "$offUNDF\n$gdxIn\n"
-        string += self._get_unload_symbols_str(dirty_names, gdx_out)
+        file.write(self._get_unload_symbols_str(dirty_names, gdx_out))
 
-        return string
+    def _generate_gams_string(
+        self,
+        gdx_in: str,
+        gdx_out: str,
+        dirty_names: list[str],
+        modified_names: list[str],
+        merge_names: list[str] | None = None,
+    ) -> str:
+        buffer = io.StringIO()
+        self._write_gams_code(
+            buffer, gdx_in, gdx_out, dirty_names, modified_names, merge_names
+        )
+
+        return buffer.getvalue()
 
     @property
     def delayed_execution(self) -> bool:
@@ -623,6 +1139,143 @@ class Container(gt.Container):
             definition_domain,
         )
 
+    def addSymbols(
+        self, specs: list[dict[str, Any]]
+    ) -> list[Set | Parameter | Variable | Equation]:
+        """
+        Creates many symbols at once and adds them to the Container. The
+        names and domains of all symbols are validated before any symbol is
+        created and the declarations are sent to GAMS in a single block. If
+        a symbol cannot be created, the symbols of the specs that were not
+        in the Container before are removed again. Existing symbols that
+        were already redeclared keep their new arguments.
+
+        Parameters
+        ----------
+        specs : list[dict[str, Any]]
+            Arguments of each symbol. The ``symbol_type`` key holds the type
+            of the symbol: "set", "parameter", "variable" or "equation". The
+            other keys are the arguments of the corresponding add method.
+
+        Returns
+        -------
+        list[Set | Parameter | Variable | Equation]
+            Symbols in the order of the specs
+
+        Raises
+        ------
+        ValidationError
+            In case a symbol type is not valid, a name is given twice, a
+            name is a reserved word or a domain set is in another container
+        TypeError
+            In case a name is not a string or there is a symbol with the
+            same name but a different type in the Container
+
+        Examples
+        --------
+        >>> import gamspy as gp
+        >>> m = gp.Container()
+        >>> i, a, x = m.addSymbols(
+        ...     [
+        ...         {"symbol_type": "set", "name": "i", "records": ["i1"]},
+        ...         {"symbol_type": "parameter", "name": "a", "domain": ["i"]},
+        ...         {"symbol_type": "variable", "name": "x", "domain": ["i"]},
+        ...     ]
+        ... )
+        >>> a.domain_names
+        ['i']
+
+        """
+        SYMBOL_TYPES = {
+            "set": gp.Set,
+            "parameter": gp.Parameter,
+            "variable": gp.Variable,
+            "equation": gp.Equation,
+        }
+
+        # Validate all specs before any symbol is created
+        classes = []
+        names = []
+        domain_sets = {}
+        for spec in specs:
+            symbol_type = spec.get("symbol_type")
+            if (
+                not isinstance(symbol_type, str)
+                or symbol_type.lower() not in SYMBOL_TYPES
+            ):
+                raise ValidationError(
+                    f"`{symbol_type}` is not a valid symbol type. Possible"
+                    f" symbol types: {list(SYMBOL_TYPES.keys())}"
+                )
+            symbol_class = SYMBOL_TYPES[symbol_type.lower()]
+
+            name = spec.get("name")
+            if not isinstance(name, str):
+                raise TypeError(
+                    f"Name must of type `str` but found {type(name)}"
+                )
+
+            if name in self.data and not isinstance(
+                self[name], symbol_class
+            ):
+                raise TypeError(
+                    f"Cannot overwrite symbol `{name}` in container"
+                    f" because it is not a {symbol_class.__name__} object"
+                )
+
+            for domain_set in spec.get("domain") or []:
+                if isinstance(domain_set, (gp.Set, gp.Alias)):
+                    domain_sets[id(domain_set)] = domain_set
+
+            classes.append(symbol_class)
+            names.append(name)
+
+        if len(set(names)) != len(names):
+            duplicates = sorted(
+                {name for name in names if names.count(name) > 1}
+            )
+            raise ValidationError(
+                f"Symbols {duplicates} are given more than once"
+            )
+
+        validation.validate_names(names)
+
+        for domain_set in domain_sets.values():
+            if domain_set.container != self:
+                raise ValidationError(
+                    f"Domain `{domain_set.name}` must be in the same"
+                    " container with the symbols"
+                )
+
+        existing_names = {name for name in names if name in self.data}
+        num_statements = len(self._unsaved_statements)
+
+        self._declaration_block = _DeclarationBlock()
+        self._are_names_validated = True
+        try:
+            symbols = []
+            for symbol_class, spec in zip(classes, specs):
+                arguments = {
+                    key: value
+                    for key, value in spec.items()
+                    if key != "symbol_type"
+                }
+                symbols.append(symbol_class(self, **arguments))
+        except Exception:
+            # Errors of the constructors, e.g. invalid records, remove the
+            # symbols that were already created along with their block
+            del self._unsaved_statements[num_statements:]
+            for name in names:
+                if name not in existing_names and name in self.data:
+                    del self.data[name]
+
+            raise
+        finally:
+            self._declaration_block = None
+            self._are_names_validated = False
+
+        return symbols
+
     def addModel(
         self,
         name: str,
@@ -697,7 +1350,13 @@ class Container(gt.Container):
         True
 
         """
-        m = Container(working_directory=working_directory)
+        m = Container(
+            working_directory=working_directory,
+            backend=self._backend,
+            timing_callback=self._timing_callback,
+            strict_validation=self._strict_validation,
+            local_evaluation=self._local_evaluation,
+        )
         if m.working_directory == self.working_directory:
             raise ValidationError(
                 "Copy of a container cannot have the same working directory"
@@ -752,7 +1411,7 @@ class Container(gt.Container):
                     symbol.description,
                 )
             elif isinstance(symbol, gt.Parameter):
-                _ = gp.Parameter(
+                new_parameter = gp.Parameter(
                     m,
                     name,
                     new_domain,
@@ -760,6 +1419,9 @@ class Container(gt.Container):
                     symbol.domain_forwarding,
                     symbol.description,
                 )
+                new_parameter._records_file = getattr(
+                    symbol, "_records_file", None
+                )
             elif isinstance(symbol, gt.Variable):
                 _ = gp.Variable(
                     m,
@@ -784,8 +1446,12 @@ class Container(gt.Container):
                     description=symbol.description,
                 )
 
+        m._share_labels()
+
+        # Share the checkpoints and gdx files through hard links. They are
+        # detached before either container overwrites them.
         try:
-            shutil.copy(
+            utils._link_or_copy(
                 self._save_to._checkpoint_file_name,
                 m._save_to._checkpoint_file_name,
             )
@@ -793,13 +1459,13 @@ class Container(gt.Container):
             # save_to might not exist and it's fine
             pass
 
-        shutil.copy(
+        utils._link_or_copy(
             self._restart_from._checkpoint_file_name,
             m._restart_from._checkpoint_file_name,
         )
 
-        shutil.copy(self._gdx_in, m._gdx_in)
-        shutil.copy(self._gdx_out, m._gdx_out)
+        utils._link_or_copy(self._gdx_in, m._gdx_in)
+        utils._link_or_copy(self._gdx_out, m._gdx_out)
 
         # if already defined equations exist, add them to .gms file
         for equation in self.getEquations():
@@ -854,20 +1520,54 @@ class Container(gt.Container):
         True
 
         """
+        DELTA_SYMBOL_TYPES = (gp.Parameter, gp.Variable, gp.Equation)
         symbol_names = self._get_symbol_names_to_load(load_from, symbol_names)
 
-        temp_container = gt.Container(system_directory=self.system_directory)
-        temp_container.read(load_from, symbol_names)
-
+        existing_names = []
+        unknown_names = []
+        deferred_paths = set()
         for name in symbol_names:
-            if name in self.data.keys():
-                updated_records = temp_container[name].records
+            deferred = self._deferred_symbols.pop(name, None)
+            if deferred is not None:
+                deferred_paths.add(deferred[1])
 
-                self[name]._records = updated_records
-                if updated_records is not None:
-                    self[name]._domain_labels = self[name].domain_names
+            if name in self.data.keys():
+                existing_names.append(name)
             else:
-                self.read(load_from, [name])
+                unknown_names.append(name)
+
+        if existing_names:
+            load_container = self._get_load_container()
+
+            try:
+                load_container.read(load_from, existing_names)
+                for name in existing_names:
+                    symbol = self[name]
+                    updated_records = load_container[name].records
+
+                    symbol._records = updated_records
+                    if updated_records is not None:
+                        symbol._domain_labels = symbol.domain_names
+                        self._share_labels([name])
+
+                    if isinstance(symbol, DELTA_SYMBOL_TYPES):
+                        symbol._sync_records()
+            finally:
+                # Records now belong to the symbols of this container. The
+                # symbols of a failed read are removed as well.
+                load_container.removeSymbols(
+                    [
+                        name
+                        for name in existing_names
+                        if name in load_container.data.keys()
+                    ]
+                )
+
+        if unknown_names:
+            self.read(load_from, unknown_names)
+
+        # Remove the preserved files that are not needed anymore
+        self._remove_unreferenced_files(deferred_paths)
 
     def read(
         self,
@@ -903,6 +1603,7 @@ class Container(gt.Container):
         """
         super().read(load_from, symbol_names, load_records, mode, encoding)
         self._cast_symbols(symbol_names)
+        self._share_labels(symbol_names)
 
     def write(
         self,
@@ -937,6 +1638,12 @@ class Container(gt.Container):
         if len(dirty_names) > 0:
             self._run(keep_flags=True)
 
+        self._load_deferred_records(symbol_names)
+        for name in symbol_names if symbol_names is not None else self.data:
+            symbol = self.data.get(name)
+            if isinstance(symbol, gp.Parameter):
+                symbol._load_records_file()
+
         super().write(
             write_to,
             symbol_names,
@@ -24,35 +24,52 @@
 #
 from __future__ import annotations
 
+import hashlib
 import io
+import json
 import os
+import re
+import shutil
+import tempfile
+import time
 import uuid
+from concurrent.futures import Future
 from enum import Enum
+from typing import Any
 from typing import Iterable
 from typing import Literal
 from typing import TYPE_CHECKING
 
 import gams.transfer as gt
+import pandas as pd
 from gams import GamsOptions
 
 import gamspy as gp
+import gamspy._cache as cache_utils
 import gamspy._algebra.expression as expression
 import gamspy._algebra.operation as operation
 import gamspy._validation as validation
 from gamspy._backend.backend import backend_factory
+from gamspy._backend.backend import TIMING_HEADER
+from gamspy._backend.backend import TRANSFER_HEADER
+from gamspy._backend.batch import Batch
 from gamspy._model_instance import ModelInstance
 from gamspy._options import _map_options
+from gamspy._options import _set_warm_start_options
 from gamspy.exceptions import ValidationError
+from gamspy.utils import _get_file_digest
+from gamspy.utils import getInstalledSolvers
 
 if TYPE_CHECKING:
-    from gamspy import Parameter, Variable, Equation, Container
+    from gamspy import Set, Parameter, Variable, Equation, Container
     from gamspy._algebra.expression import Expression
     from gamspy._algebra.operation import Operation
     from gamspy._symbols.implicits import ImplicitParameter
     from gamspy._options import Options
+    from gamspy._backend.batch import ScenarioResult
     from gamspy._backend.engine import EngineConfig
     from gamspy._backend.neos import NeosClient
-    import pandas as pd
+    from gamspy._cache import SolveCache
 
 
 class Problem(Enum):
@@ -155,6 +172,17 @@ attribute_map = {
     "sysVer": "solver_version",
 }
 
+# Line of the execution profile for the generation of an equation block:
+# ----   <line> Equation   <name>   <time> <cumulative time> SECS
+# <memory> MB   <rows>
+PROFILE_EQUATION_LINE = re.compile(
+    r"^----\s+\d+\s+Equation\s+(\S+)\s+(\S+)\s+\S+\s+SECS\s+(\S+)\s+MB"
+    r"\s+(\d+)"
+)
+
+# Names in GAMS statements, used to find the symbols a solve depends on
+IDENTIFIER_PATTERN = re.compile(r"[A-Za-z_][A-Za-z0-9_]*")
+
 
 class Model:
     """
@@ -219,6 +247,9 @@ class Model:
         # allow freezing
         self._is_frozen = False
 
+        # solve statement and attribute assignments of a compiled model
+        self._compiled_solve_string: str | None = None
+
         # Attributes
         self.num_domain_violations = None
         self.algorithm_time = None
@@ -345,6 +376,7 @@ class Model:
         solver_options: dict | None = None,
         output: io.TextIOWrapper | None = None,
         create_log_file: bool = False,
+        warm_start: bool = False,
     ) -> GamsOptions:
         gams_options = _map_options(
             self.container.workspace,
@@ -359,6 +391,22 @@ class Model:
         if solver:
             gams_options.all_model_types = solver
 
+        if warm_start:
+            solver, warm_start_options = _set_warm_start_options(
+                gams_options,
+                str(self.problem),
+                solver,
+                options,
+                self.container._options,
+            )
+
+            # Solver options of the user take precedence
+            if warm_start_options:
+                solver_options = {
+                    **warm_start_options,
+                    **(solver_options or {}),
+                }
+
         if solver_options:
             if solver is None:
                 raise ValidationError(
@@ -412,6 +460,11 @@ class Model:
         return problem, sense
 
     def _append_solve_string(self) -> None:
+        self.container._unsaved_statements.append(
+            self._get_solve_string() + "\n"
+        )
+
+    def _get_solve_string(self) -> str:
         solve_string = f"solve {self.name} using {self.problem}"
 
         if self.sense:
@@ -424,7 +477,7 @@ class Model:
         if self._objective_variable:
             solve_string += f" {self._objective_variable.gamsRepr()}"
 
-        self.container._unsaved_statements.append(solve_string + ";\n")
+        return solve_string + ";"
 
     def _create_model_attributes(self) -> None:
         for attr_name in attribute_map.keys():
@@ -435,12 +488,22 @@ class Model:
                 f"{symbol_name} = {self.name}.{attr_name};"
             )
 
-    def _update_model_attributes(self) -> None:
+    def _append_solve_statements(self) -> None:
+        if self._compiled_solve_string is not None:
+            self.container._unsaved_statements.append(
+                self._compiled_solve_string
+            )
+            return
+
+        self._append_solve_string()
+        self._create_model_attributes()
+
+    def _update_model_attributes(self, gdx_path: str | None = None) -> None:
         temp_container = gt.Container(
             system_directory=self.container.system_directory
         )
         temp_container.read(
-            self.container._gdx_out,
+            self.container._gdx_out if gdx_path is None else gdx_path,
             [
                 f"{self._generate_prefix}{self.name}_{gams_attr}"
                 for gams_attr in attribute_map.keys()
@@ -463,30 +526,217 @@ class Model:
                     temp_container[symbol_name].toValue(),
                 )
 
-    def _make_variable_and_equations_dirty(self):
+    def _get_result_symbols(self) -> list[Variable | Equation]:
+        """Returns the variables and equations that a solve changes"""
+        symbols: dict[str, Variable | Equation] = {}
         if (
             self._objective_variable is not None
             and not self._objective_variable.name.startswith(
                 Model._generate_prefix
             )
         ):
-            self._objective_variable._is_dirty = True
+            symbols[self._objective_variable.name] = self._objective_variable
 
         for equation in self.equations:
             if equation.name.startswith(Model._generate_prefix):
                 continue
 
-            equation._is_dirty = True
+            symbols[equation.name] = equation
 
             if equation._definition is not None:
                 variables = equation._definition.find_variables()
                 for name in variables:
-                    self.container[name]._is_dirty = True
+                    symbols[name] = self.container[name]
 
         if self._matches:
             for equation, variable in self._matches.items():
-                equation._is_dirty = True
-                variable._is_dirty = True
+                symbols[equation.name] = equation
+                symbols[variable.name] = variable
+
+        return list(symbols.values())
+
+    def _get_cache_key(
+        self,
+        solver: str | None,
+        options: Options | None,
+        solver_options: dict | None,
+        warm_start: bool = False,
+    ) -> str | None:
+        """
+        Fingerprints the statements of the model, the unsaved statements
+        that are run before the solve, the declarations and records of the
+        symbols they reference and the solve settings. Records of the
+        parameters that are kept in files are fingerprinted by the content
+        of the file.
+
+        Returns
+        -------
+        str | None
+            None if the records of a referenced symbol are only on the
+            GAMS side, so the solve cannot be fingerprinted without loading
+            them.
+        """
+        digest = hashlib.sha256()
+
+        def update(text: str):
+            # Names of the autogenerated objectives differ in each run
+            text = re.sub(
+                Model._generate_prefix + r"[0-9a-f]{8}(_[0-9a-f]{4}){3}_"
+                r"[0-9a-f]{12}_",
+                Model._generate_prefix,
+                text,
+            )
+            digest.update(text.encode())
+            digest.update(b"\0")
+
+        statements = [self.getStatement(), self._get_solve_string()]
+        for equation in self.equations:
+            statements.append(equation.getStatement())
+            if equation._definition is not None:
+                statements.append(equation._definition.getStatement())
+
+        # Declarations are fingerprinted with the referenced symbols below,
+        # so only the other unsaved statements are added
+        from gamspy._container import _DeclarationBlock
+
+        for statement in self.container._unsaved_statements:
+            if isinstance(statement, str):
+                statements.append(statement)
+            elif not isinstance(
+                statement,
+                (
+                    gp.Set,
+                    gp.Alias,
+                    gp.UniverseAlias,
+                    gp.Parameter,
+                    gp.Variable,
+                    gp.Equation,
+                    _DeclarationBlock,
+                ),
+            ):
+                statements.append(statement.getStatement())
+
+        identifiers = set()
+        for statement in dict.fromkeys(statements):
+            update(statement)
+            identifiers.update(IDENTIFIER_PATTERN.findall(statement))
+
+        update(solver.lower() if solver else "")
+        update(json.dumps(solver_options, sort_keys=True, default=str))
+        update(str(warm_start))
+        for settings in (self.container._options, options):
+            update(
+                ""
+                if settings is None
+                else json.dumps(settings.model_dump(), default=str)
+            )
+
+        # Referenced symbols and the sets of their domains
+        pending = []
+        for identifier in identifiers:
+            if identifier.startswith(Model._generate_prefix):
+                continue
+
+            try:
+                pending.append(self.container[identifier])
+            except KeyError:
+                continue
+
+        symbols: dict[str, Any] = {}
+        while pending:
+            symbol = pending.pop()
+            if symbol.name in symbols:
+                continue
+
+            symbols[symbol.name] = symbol
+            if isinstance(symbol, gp.Alias):
+                pending.append(symbol.alias_with)
+
+            for domain_set in getattr(symbol, "domain", []):
+                if isinstance(domain_set, (gp.Set, gp.Alias)):
+                    pending.append(domain_set)
+
+        for name in sorted(symbols.keys()):
+            symbol = symbols[name]
+            if (
+                getattr(symbol, "_is_dirty", False)
+                or name in self.container._deferred_symbols
+            ):
+                return None
+
+            # The declaration holds e.g. the type of a variable
+            update(
+                f"{type(symbol).__name__} {symbol.getStatement()}"
+                f" {getattr(symbol, 'type', '')} {symbol.domain_names}"
+            )
+
+            if isinstance(symbol, gp.Alias):
+                # Records are the ones of alias_with
+                continue
+
+            records_file = getattr(symbol, "_records_file", None)
+            if records_file is not None:
+                path, chunk_size = records_file
+                update(f"{_get_file_digest(path)} {chunk_size}")
+                continue
+
+            records = symbol._records
+            if records is None:
+                update("None")
+            else:
+                update(",".join(str(column) for column in records.columns))
+                digest.update(
+                    pd.util.hash_pandas_object(records, index=False)
+                    .to_numpy()
+                    .tobytes()
+                )
+
+        return f"{self.name}-{digest.hexdigest()}"
+
+    def _load_cached_results(self, entry: bytes) -> pd.DataFrame | None:
+        """
+        Sets the records of the variables and equations of the model and
+        the model attributes from a cache entry. The records are marked as
+        modified so that they are sent to GAMS in the next run. The timing
+        and transfer columns of the summary describe the load of the entry
+        instead of the cached solve.
+        """
+        start = time.perf_counter()
+        gdx_path = os.path.join(
+            self.container.working_directory, f"_cache_{uuid.uuid4()}.gdx"
+        )
+        summary = cache_utils._unpack_entry(entry, gdx_path)
+
+        try:
+            symbols = self._get_result_symbols()
+            temp_container = gt.Container(
+                system_directory=self.container.system_directory
+            )
+            temp_container.read(gdx_path, [symbol.name for symbol in symbols])
+
+            for symbol in symbols:
+                symbol.records = temp_container[symbol.name].records
+            self.container._share_labels([symbol.name for symbol in symbols])
+
+            self._update_model_attributes(gdx_path)
+        finally:
+            os.remove(gdx_path)
+
+        if summary is not None:
+            for column in [*TIMING_HEADER.values(), *TRANSFER_HEADER]:
+                if column in summary.columns:
+                    summary[column] = 0
+
+            if "GDX Read Time" in summary.columns:
+                summary["GDX Read Time"] = time.perf_counter() - start
+            if "Bytes Read" in summary.columns:
+                summary["Bytes Read"] = len(entry)
+
+        return summary
+
+    def _make_variable_and_equations_dirty(self):
+        for symbol in self._get_result_symbols():
+            symbol._is_dirty = True
 
     def interrupt(self) -> None:
         """
@@ -502,6 +752,166 @@ class Model:
         else:
             raise ValidationError("There is no initialized job to interrupt.")
 
+    def compile(self) -> None:
+        """
+        Compiles the equations of the model and the declarations of its
+        attributes into the checkpoint once. Later solves only send the
+        changed data and a prebuilt solve statement instead of declaring
+        the model attributes again. The attributes are unloaded only by the
+        runs that solve this model. Unlike freeze, the model is still
+        generated from scratch by GAMS in each solve, so changes in
+        nonlinear terms and in the domains of the equations are reflected.
+
+        Raises
+        ------
+        ValidationError
+            In case the model is frozen
+
+        Examples
+        --------
+        >>> transport.compile() # doctest: +SKIP
+        >>> for value in [300, 325, 350]: # doctest: +SKIP
+        ...     b["new-york"] = value
+        ...     transport.solve()
+        """
+        if self._is_frozen:
+            raise ValidationError("Frozen models cannot be compiled.")
+
+        symbol_names = [
+            f"{self._generate_prefix}{self.name}_{attr_name}"
+            for attr_name in attribute_map.keys()
+        ]
+        self.container._unsaved_statements.append(
+            "Parameter " + ",".join(symbol_names) + ";"
+        )
+
+        statements = [self._get_solve_string()]
+        for symbol_name, attr_name in zip(symbol_names, attribute_map.keys()):
+            statements.append(f"{symbol_name} = {self.name}.{attr_name};")
+
+        self.container._run()
+
+        self._compiled_solve_string = "\n".join(statements)
+        self.container._compiled_solves[self._compiled_solve_string] = (
+            symbol_names
+        )
+
+    def generate(
+        self,
+        options: Options | None = None,
+        output: io.TextIOWrapper | None = None,
+    ) -> pd.DataFrame:
+        """
+        Generates the model without solving it and reports the statistics
+        of each equation block. The model is passed to the CONVERT solver
+        instead of a real solver and the execution profile of GAMS is read
+        from the listing file. The totals of the model such as the number
+        of nonzeros and the nonlinear code size are set in the model
+        attributes.
+
+        Parameters
+        ----------
+        options : Options, optional
+            GAMS options. Profile options are overridden.
+        output : TextIOWrapper, optional
+            Output redirection target
+
+        Returns
+        -------
+        DataFrame
+            Number of rows, generation time in seconds and memory use in
+            MB after the generation of each equation block, sorted by the
+            generation time
+
+        Raises
+        ------
+        ValidationError
+            In case the model is frozen or CONVERT is not installed
+
+        Examples
+        --------
+        >>> statistics = transport.generate() # doctest: +SKIP
+        >>> transport.num_nonzeros # doctest: +SKIP
+        19.0
+        """
+        if self._is_frozen:
+            raise ValidationError("Frozen models cannot be generated.")
+
+        if "CONVERT" not in getInstalledSolvers():
+            raise ValidationError(
+                "Models are generated with the CONVERT solver but it is not"
+                " installed."
+            )
+
+        options = options if options is not None else gp.Options()
+        options = options.model_copy(
+            update={
+                "profile": 1,
+                "profile_tolerance": 0,
+                "write_listing_file": True,
+            }
+        )
+
+        # CONVERT writes the scalar model to a directory that is removed
+        # after the run
+        directory = tempfile.mkdtemp(dir=self.container.working_directory)
+        try:
+            gams_options = self._prepare_gams_options(
+                "CONVERT",
+                options=options,
+                solver_options={
+                    "gams": f'"{os.path.join(directory, "gams.gms")}"'
+                },
+                output=output,
+            )
+
+            self._append_solve_statements()
+
+            runner = backend_factory(self.container, gams_options, output)
+            runner.solve()
+        finally:
+            shutil.rmtree(directory, ignore_errors=True)
+
+        self._update_model_attributes()
+
+        return self._read_generation_profile(
+            os.path.join(
+                self.container.working_directory, runner.job_name + ".lst"
+            )
+        )
+
+    def _read_generation_profile(self, listing_path: str) -> pd.DataFrame:
+        """Reads the equation blocks from the profile in the listing file"""
+        names = {name.lower(): name for name in self.container.data.keys()}
+
+        rows = []
+        with open(listing_path) as file:
+            for line in file:
+                match = PROFILE_EQUATION_LINE.match(line)
+                if match is None:
+                    continue
+
+                name, time, memory, count = match.groups()
+                rows.append(
+                    [
+                        names.get(name.lower(), name),
+                        int(count),
+                        float(time),
+                        float(memory),
+                    ]
+                )
+
+        statistics = pd.DataFrame(
+            rows, columns=["Equation", "Rows", "Generation Time", "Memory"]
+        )
+
+        return statistics.sort_values(
+            "Generation Time",
+            ascending=False,
+            ignore_index=True,
+            kind="stable",
+        )
+
     def freeze(
         self,
         modifiables: list[Parameter | ImplicitParameter],
@@ -522,6 +932,59 @@ class Model:
         )
         self._is_frozen = True
 
+    def solve_scenarios(
+        self,
+        scenarios: dict[Parameter | ImplicitParameter, pd.DataFrame],
+        model_instance_options: dict | None = None,
+        output: io.TextIOWrapper | None = None,
+    ) -> tuple[pd.DataFrame, dict[str, pd.DataFrame]]:
+        """
+        Solves the frozen model for each scenario without going through the
+        main container in between. The first column of each scenario table
+        holds the scenario labels and the remaining columns hold the records
+        of the modifiable in that scenario. Each table must have records for
+        every scenario.
+
+        Parameters
+        ----------
+        scenarios : dict[Parameter | ImplicitParameter, DataFrame]
+            Scenario table of each modifiable
+        model_instance_options : dict, optional
+            Model instance options
+        output : TextIOWrapper, optional
+            Output redirection target
+
+        Returns
+        -------
+        tuple[DataFrame, dict[str, DataFrame]]
+            Statuses of the scenarios and the stacked records of the
+            variables and equations of the model by symbol name
+
+        Raises
+        ------
+        ValidationError
+            In case the model is not frozen or a scenario table has no
+            records for some scenarios
+
+        Examples
+        --------
+        >>> transport.freeze(modifiables=[bmult]) # doctest: +SKIP
+        >>> scenarios = pd.DataFrame( # doctest: +SKIP
+        ...     [["s1", 0.9], ["s2", 1.1]], columns=["scenario", "value"]
+        ... )
+        >>> summary, records = transport.solve_scenarios( # doctest: +SKIP
+        ...     {bmult: scenarios}
+        ... )
+        """
+        if not self._is_frozen:
+            raise ValidationError(
+                "Scenarios can only be solved after the model is frozen."
+            )
+
+        return self.instance.solve_scenarios(
+            scenarios, model_instance_options, output
+        )
+
     def unfreeze(self) -> None:
         """Unfreezes all symbols"""
         for symbol in self.container.data.values():
@@ -537,10 +1000,14 @@ class Model:
         solver_options: dict | None = None,
         model_instance_options: dict | None = None,
         output: io.TextIOWrapper | None = None,
-        backend: Literal["local", "engine", "neos"] = "local",
+        backend: Literal["local", "session", "engine", "neos"] = "local",
         engine_config: EngineConfig | None = None,
         neos_client: NeosClient | None = None,
         create_log_file: bool = False,
+        load_symbols: list[Set | Parameter | Variable | Equation]
+        | None = None,
+        cache: SolveCache | None = None,
+        warm_start: bool = False,
     ) -> pd.DataFrame | None:
         """
         Generates the gams string, writes it to a file and runs it
@@ -558,13 +1025,30 @@ class Model:
         output : TextIOWrapper, optional
             Output redirection target
         backend : str, optional
-            Backend to run on
+            Backend to run on. Possible backends: local, session, engine and
+            neos. By default "local".
         engine_config : EngineConfig, optional
             GAMS Engine configuration
         neos_client : NeosClient, optional
             NEOS Client to communicate with NEOS Server
         create_log_file : bool
             Allows creating a log file
+        load_symbols : List[Set | Parameter | Variable | Equation], optional
+            Symbols whose records are loaded right after the solve. Records
+            of the other symbols are loaded when they are accessed. By
+            default, records of all symbols are loaded.
+        cache : SolveCache, optional
+            Cache of solve results. If the statements of the model, the
+            records of the symbols in the container and the solve settings
+            match a cached solve, the stored results are loaded instead of
+            running GAMS. Otherwise, the results are stored in the cache
+            after the solve. Frozen models are not cached.
+        warm_start : bool, optional
+            Makes the solver start from the levels and marginals of the
+            previous solve by always building an advanced basis from them
+            and, for MIP problems of CPLEX, Gurobi, Xpress and CBC, by
+            passing the levels as the first integer solution. By default
+            False.
 
         Raises
         ------
@@ -576,6 +1060,10 @@ class Model:
         ValueError
             In case sense is different than "MIN" or "MAX"
         """
+        # A pending asynchronous solve must load its results and clean up
+        # its autogenerated symbols before this one marks its symbols dirty
+        self.container._wait_for_pending_run()
+
         if self._is_frozen:
             self.instance.solve(model_instance_options, output)
             return None
@@ -587,10 +1075,19 @@ class Model:
             solver_options,
             output=output,
             create_log_file=create_log_file,
+            warm_start=warm_start,
         )
 
-        self._append_solve_string()
-        self._create_model_attributes()
+        cache_key = None
+        if cache is not None:
+            cache_key = self._get_cache_key(
+                solver, options, solver_options, warm_start
+            )
+            entry = None if cache_key is None else cache.get(cache_key)
+            if entry is not None:
+                return self._load_cached_results(entry)
+
+        self._append_solve_statements()
         self._make_variable_and_equations_dirty()
 
         runner = backend_factory(
@@ -600,6 +1097,11 @@ class Model:
             backend,
             engine_config,
             neos_client,
+            load_symbols=(
+                None
+                if load_symbols is None
+                else [symbol.name for symbol in load_symbols]
+            ),
         )
 
         summary = runner.solve()
@@ -607,8 +1109,201 @@ class Model:
         if not runner.is_async():
             self._update_model_attributes()
 
+            if cache_key is not None:
+                cache.put(
+                    cache_key,
+                    cache_utils._pack_entry(self.container._gdx_out, summary),
+                )
+
         return summary
 
+    def solve_async(
+        self,
+        solver: str | None = None,
+        options: Options | None = None,
+        solver_options: dict | None = None,
+        output: io.TextIOWrapper | None = None,
+        backend: Literal["local", "engine"] = "local",
+        engine_config: EngineConfig | None = None,
+        create_log_file: bool = False,
+        load_symbols: list[Set | Parameter | Variable | Equation]
+        | None = None,
+    ) -> Future:
+        """
+        Generates the gams string and runs it in the background. Records of
+        the variables and equations and the model attributes are updated
+        once the solve is completed. Accessing the records of the changed
+        symbols or running another statement on the container waits for
+        the solve.
+
+        Parameters
+        ----------
+        solver : str, optional
+            Solver name
+        options : Options, optional
+            GAMS options
+        solver_options : dict, optional
+            Solver options
+        output : TextIOWrapper, optional
+            Output redirection target
+        backend : str, optional
+            Backend to run on. Possible backends: local and engine. By
+            default "local".
+        engine_config : EngineConfig, optional
+            GAMS Engine configuration
+        create_log_file : bool
+            Allows creating a log file
+        load_symbols : List[Set | Parameter | Variable | Equation], optional
+            Symbols whose records are loaded right after the solve. Records
+            of the other symbols are loaded when they are accessed. By
+            default, records of all symbols are loaded.
+
+        Returns
+        -------
+        Future
+            Future that resolves to the summary of the solve. It can be
+            awaited with ``asyncio.wrap_future``.
+
+        Raises
+        ------
+        ValidationError
+            In case the model is frozen or the backend is not local or
+            engine.
+
+        Examples
+        --------
+        >>> future = model.solve_async() # doctest: +SKIP
+        >>> summary = future.result() # doctest: +SKIP
+        """
+        if backend not in ["local", "engine"]:
+            raise ValidationError(
+                "Asynchronous solves can only run on `local` or `engine`"
+                f" backends but found `{backend}`"
+            )
+
+        if self._is_frozen:
+            raise ValidationError(
+                "Frozen models cannot be solved asynchronously."
+            )
+
+        gams_options = self._prepare_gams_options(
+            solver,
+            backend,
+            options,
+            solver_options,
+            output=output,
+            create_log_file=create_log_file,
+        )
+
+        # The previous solve must load its results before this one marks
+        # its symbols dirty
+        self.container._wait_for_pending_run()
+        self._append_solve_statements()
+        self._make_variable_and_equations_dirty()
+
+        runner = backend_factory(
+            self.container,
+            gams_options,
+            output,
+            backend,
+            engine_config,
+            load_symbols=(
+                None
+                if load_symbols is None
+                else [symbol.name for symbol in load_symbols]
+            ),
+        )
+
+        return self.container._submit_run(
+            runner, self._update_model_attributes
+        )
+
+    def solve_batch(
+        self,
+        scenarios: Iterable[dict[Parameter, Any]],
+        solver: str | None = None,
+        options: Options | None = None,
+        solver_options: dict | None = None,
+        backend: Literal["local", "engine", "neos"] = "local",
+        engine_config: EngineConfig | None = None,
+        workers: int | None = None,
+        load_symbols: list[Set | Parameter | Variable | Equation]
+        | None = None,
+        neos_client: NeosClient | None = None,
+    ) -> list[ScenarioResult]:
+        """
+        Solves the model for each scenario in parallel. Each scenario
+        restarts from the current state of the container with the given
+        parameter records. Records of the container are not changed.
+
+        Parameters
+        ----------
+        scenarios : Iterable[dict[Parameter, Any]]
+            Records of the parameters for each scenario. Records can be in
+            any format that Parameter.setRecords accepts.
+        solver : str, optional
+            Solver name
+        options : Options, optional
+            GAMS options
+        solver_options : dict, optional
+            Solver options
+        backend : str, optional
+            Backend to run on. Possible backends: local, engine and neos. By
+            default "local".
+        engine_config : EngineConfig, optional
+            GAMS Engine configuration
+        workers : int, optional
+            Number of scenarios that run at the same time, by default the
+            number of CPUs.
+        load_symbols : List[Set | Parameter | Variable | Equation], optional
+            Symbols whose records are collected for each scenario. By
+            default, records of the variables and equations of the model.
+        neos_client : NeosClient, optional
+            NEOS Client to communicate with NEOS Server
+
+        Returns
+        -------
+        list[ScenarioResult]
+            Results of the scenarios in the given order
+
+        Raises
+        ------
+        ValidationError
+            In case the model is frozen, the backend is not local, engine or
+            neos or the neos backend is used without a client.
+        GamspyException
+            In case one of the scenarios fails.
+
+        Examples
+        --------
+        >>> results = model.solve_batch( # doctest: +SKIP
+        ...     [{demand: [("new-york", value)]} for value in [300, 325]]
+        ... )
+        >>> [result.objective_value for result in results] # doctest: +SKIP
+        """
+        if self._is_frozen:
+            raise ValidationError("Frozen models cannot be solved in batch.")
+
+        gams_options = self._prepare_gams_options(
+            solver, backend, options, solver_options
+        )
+
+        runner = Batch(
+            self,
+            gams_options,
+            backend,
+            engine_config,
+            workers,
+            load_symbols=(
+                None
+                if load_symbols is None
+                else [symbol.name for symbol in load_symbols]
+            ),
+            neos_client=neos_client,
+        )
+
+        return runner.solve(list(scenarios))
+
     def getStatement(self) -> str:
         """
         Statement of the Model definition
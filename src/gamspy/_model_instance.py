@@ -27,6 +27,8 @@ from __future__ import annotations
 import io
 from typing import TYPE_CHECKING
 
+import gams.transfer as gt
+import pandas as pd
 from gams import EquType
 from gams import GamsModelInstanceOpt
 from gams import GamsModifier
@@ -127,9 +129,9 @@ class ModelInstance:
         # get options from dict
         options, update_type = self._prepare_options(options_dict)
 
-        # update sync_db
-        self.main_container.write(self.instance.sync_db._gmd)
-
+        # update sync_db with the records of the modifiables only
+        parameter_names = []
+        attr_names = []
         for modifiable in self.modifiables:
             if isinstance(modifiable, implicits.ImplicitParameter):
                 if modifiable.parent.records is not None:
@@ -143,8 +145,19 @@ class ModelInstance:
                             columns, axis=1
                         )
                     )
+                    attr_names.append(attr_name)
+            else:
+                parameter_names.append(modifiable.name)
+
+        if parameter_names:
+            self.main_container.write(
+                self.instance.sync_db._gmd, parameter_names
+            )
 
-                    self.instance_container.write(self.instance.sync_db._gmd)
+        if attr_names:
+            self.instance_container.write(
+                self.instance.sync_db._gmd, attr_names
+            )
 
         # solve
         self.instance.solve(
@@ -157,6 +170,180 @@ class ModelInstance:
         # update model status
         self.model.status = gp.ModelStatus(self.instance.model_status)
 
+    def solve_scenarios(
+        self,
+        scenarios: dict[Parameter | ImplicitParameter, pd.DataFrame],
+        options_dict: dict | None = None,
+        output: io.TextIOWrapper | None = None,
+    ) -> tuple[pd.DataFrame, dict[str, pd.DataFrame]]:
+        """
+        Solves the model instance for each scenario. The first column of
+        each scenario table holds the scenario labels and the remaining
+        columns hold the records of the modifiable in that scenario. Each
+        table must have records for every scenario. Records of the main
+        container are not changed.
+
+        Parameters
+        ----------
+        scenarios : dict[Parameter | ImplicitParameter, DataFrame]
+            Scenario table of each modifiable
+        options_dict : dict, optional
+            Model instance options
+        output : TextIOWrapper, optional
+            Output redirection target
+
+        Returns
+        -------
+        tuple[DataFrame, dict[str, DataFrame]]
+            Statuses of the scenarios and the stacked records of the
+            variables and equations of the model by symbol name. The first
+            column of each DataFrame is the scenario label.
+
+        Raises
+        ------
+        ValidationError
+            In case a scenario table has no records for some scenarios
+        """
+        options, update_type = self._prepare_options(options_dict)
+
+        scenario_container = gt.Container(
+            system_directory=self.main_container.system_directory
+        )
+
+        # Split the scenario tables once instead of filtering them for
+        # every scenario
+        labels: dict = {}
+        scenario_records: dict[str, dict] = {}
+        for modifiable, table in scenarios.items():
+            if not isinstance(table, pd.DataFrame):
+                raise ValidationError(
+                    "Scenario table of a modifiable must be a DataFrame"
+                )
+
+            scenario_column = table.columns[0]
+            groups = {
+                label: group.drop(columns=scenario_column)
+                for label, group in table.groupby(
+                    scenario_column, sort=False, observed=True
+                )
+            }
+            labels.update(dict.fromkeys(groups.keys()))
+
+            for name in self._get_data_symbol_names(modifiable):
+                scenario_records[name] = groups
+                _ = gt.Parameter(
+                    scenario_container,
+                    name,
+                    domain=["*"] * (table.shape[1] - 2),
+                )
+
+        # A scenario without records of a modifiable would silently clear
+        # the modifiable in that scenario
+        for modifiable in scenarios.keys():
+            groups = scenario_records[
+                self._get_data_symbol_names(modifiable)[0]
+            ]
+            missing = [label for label in labels if label not in groups]
+            if missing:
+                raise ValidationError(
+                    f"Scenario table of `{modifiable.name}` has no records"
+                    f" for the scenarios {missing}"
+                )
+
+        result_names = [
+            symbol.name for symbol in self.model._get_result_symbols()
+        ]
+        objective_name = (
+            self.model._objective_variable.name
+            if self.model._objective_variable is not None
+            else None
+        )
+        result_container = gt.Container(
+            system_directory=self.main_container.system_directory
+        )
+
+        statuses = []
+        results: dict[str, list[pd.DataFrame]] = {
+            name: [] for name in result_names
+        }
+        for label in labels.keys():
+            for name, groups in scenario_records.items():
+                scenario_container[name].setRecords(groups[label])
+
+            scenario_container.write(self.instance.sync_db._gmd)
+
+            self.instance.solve(
+                update_type=update_type, output=output, mi_opt=options
+            )
+
+            objective_value = None
+            if objective_name is not None:
+                objective_value = (
+                    self.instance.sync_db[objective_name].first_record().level
+                )
+
+            statuses.append(
+                [
+                    label,
+                    gp.ModelStatus(self.instance.model_status).name,
+                    self.instance.solver_status,
+                    objective_value,
+                ]
+            )
+
+            sync_db_names = {symbol.name for symbol in self.instance.sync_db}
+            names = [name for name in result_names if name in sync_db_names]
+            if not names:
+                continue
+
+            result_container.read(self.instance.sync_db._gmd, names)
+            for name in names:
+                records = result_container[name].records
+                if records is not None:
+                    records.insert(0, "scenario", label)
+                    results[name].append(records)
+
+            result_container.removeSymbols(names)
+
+        summary = pd.DataFrame(
+            statuses,
+            columns=["scenario", "Model Status", "Solver Status", "Objective"],
+        )
+        stacked_records = {
+            name: pd.concat(frames, ignore_index=True)
+            for name, frames in results.items()
+            if frames
+        }
+
+        return summary, stacked_records
+
+    def _get_data_symbol_names(
+        self, modifiable: Parameter | ImplicitParameter
+    ) -> list[str]:
+        """
+        Returns the names of the sync_db symbols that hold the data of the
+        given modifiable.
+        """
+        if isinstance(modifiable, implicits.ImplicitParameter):
+            parent_name, attr = modifiable.name.split(".")
+            attrs = ["l", "lo", "up"] if attr == "fx" else [attr]
+            names = ["_".join([parent_name, attr]) for attr in attrs]
+        else:
+            names = [modifiable.name]
+
+        modifiable_names = [
+            "_".join(modifiable.name.split("."))
+            for modifiable in self.modifiables
+        ]
+        for name in names:
+            if name not in modifiable_names:
+                raise ValidationError(
+                    f"`{modifiable.name}` is not a modifiable of the model"
+                    " instance"
+                )
+
+        return names
+
     def _init_modifiables(
         self, modifiables: list[Parameter | ImplicitParameter]
     ) -> list[Parameter | ImplicitParameter]:
@@ -317,12 +504,26 @@ class ModelInstance:
         return self.instance.solver_status
 
     def _update_main_container(self):
-        temp = gp.Container(
-            system_directory=self.main_container.system_directory,
-            working_directory=self.main_container.workspace.working_directory,
+        """
+        Loads the records of the variables and equations of the model from
+        the sync_db into the main container.
+        """
+        sync_db_names = {symbol.name for symbol in self.instance.sync_db}
+        symbol_names = [
+            symbol.name
+            for symbol in self.model._get_result_symbols()
+            if symbol.name in sync_db_names
+        ]
+
+        if not symbol_names:
+            return
+
+        self.main_container.loadRecordsFromGdx(
+            self.instance.sync_db._gmd, symbol_names
         )
-        temp.read(self.instance.sync_db._gmd)
 
-        for name in temp.data.keys():
-            if name in self.main_container.data.keys():
-                self.main_container[name].records = temp[name].records
+        # GAMS does not know the results of the frozen solve yet
+        for name in symbol_names:
+            symbol = self.main_container[name]
+            symbol._synced_records = None
+            symbol.modified = True
@@ -51,6 +51,18 @@ if TYPE_CHECKING:
 
 multi_solve_map = {"replace": 0, "merge": 1, "clear": 2}
 
+# Problem types whose solvers can start from an integer solution
+mip_start_problems = ["MIP", "MIQCP", "MINLP"]
+
+# Solver options that make the solver take the current levels of the
+# variables as the first integer solution
+mip_start_map = {
+    "CBC": {"mipstart": 1},
+    "CPLEX": {"mipstart": 1},
+    "GUROBI": {"mipstart": 1},
+    "XPRESS": {"loadmipsol": 1},
+}
+
 # GAMSPy to GAMS Control mapping
 option_map = {
     "cns": "cns",
@@ -267,6 +279,70 @@ def _set_trace_options(
     return gams_options
 
 
+def _set_warm_start_options(
+    gams_options: GamsOptions,
+    problem: str,
+    solver: Optional[str] = None,
+    options: Optional[Options] = None,
+    global_options: Optional[Options] = None,
+) -> tuple[Optional[str], dict]:
+    """
+    Makes GAMS always build an advanced basis from the current levels and
+    marginals unless a basis detection threshold is given. Returns the
+    solver of the problem type and the solver options that make it start
+    from the current levels in MIP problems. If no solver is given, the
+    default solver of the problem type is used.
+
+    Parameters
+    ----------
+    gams_options : GamsOptions
+    problem : str
+        Problem type of the model
+    solver : str, optional
+        Solver of the solve
+    options : Options, optional
+        Options of the solve
+    global_options : Options, optional
+        Options of the container
+
+    Returns
+    -------
+    tuple[str | None, dict]
+    """
+    given_options = [
+        option for option in (global_options, options) if option is not None
+    ]
+    if all(
+        option.basis_detection_threshold is None for option in given_options
+    ):
+        gams_options.bratio = 0
+
+    # Options of the solve take precedence over the options of the container
+    if solver is None:
+        for option in reversed(given_options):
+            solver = getattr(option, problem.lower(), None)
+            if solver is not None:
+                break
+
+    if problem.upper() not in mip_start_problems:
+        return solver, {}
+
+    if solver is None:
+        import gamspy.utils as utils
+
+        solver = utils._get_default_solvers().get(problem.upper())
+
+    if solver is None or solver.upper() not in mip_start_map:
+        logger.log(
+            logging.WARNING,
+            f"Solver {solver} cannot start from the current levels of the"
+            " variables. Only the advanced basis is used.",
+        )
+        return solver, {}
+
+    return solver, dict(mip_start_map[solver.upper()])
+
+
 def _map_options(
     workspace: GamsWorkspace,
     backend: str = "local",
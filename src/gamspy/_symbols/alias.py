@@ -90,6 +90,23 @@ class Alias(gt.Alias, operable.Operable, Symbol, SetMixin):
 
         validation.validate_container(self, self.domain)
         self.where = condition.Condition(self)
+
+        # Aliases are not tracked as modified symbols. They share the
+        # records of alias_with, whose changes are tracked instead, and
+        # GAMS never loads an Alias.
+        self.container._add_statement(self)
+        self._current_index = 0
+
+    def _adopt(self) -> None:
+        """
+        Initializes the GAMSPy state of a gams.transfer Alias whose class
+        was changed to Alias without rebuilding it.
+        """
+        validation.validate_name(self.name)
+        self._is_dirty = False
+        self.where = condition.Condition(self)
+
+        # Not tracked for the same reason as in __init__
         self.container._add_statement(self)
         self._current_index = 0
 
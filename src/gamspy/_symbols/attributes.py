@@ -0,0 +1,26 @@
+from __future__ import annotations
+
+from typing import TYPE_CHECKING
+
+if TYPE_CHECKING:
+    from gamspy._symbols.implicits import ImplicitParameter
+
+
+class AttributeMixin:
+    """
+    Lazily created attributes (e.g. level and marginal) of variables,
+    equations and their implicit counterparts. Subclasses initialize
+    _implicit_attributes and implement _create_attr.
+    """
+
+    def _get_attr(self, attr_name: str) -> ImplicitParameter:
+        """
+        Implicit parameter of the given attribute. It is created on first
+        access so that declaring symbols does not create all attributes.
+        """
+        attribute = self._implicit_attributes.get(attr_name)
+        if attribute is None:
+            attribute = self._create_attr(attr_name)
+            self._implicit_attributes[attr_name] = attribute
+
+        return attribute
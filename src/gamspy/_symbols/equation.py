@@ -38,10 +38,12 @@ import gamspy._algebra.operable as operable
 import gamspy._symbols.implicits as implicits
 import gamspy._validation as validation
 import gamspy.utils as utils
+from gamspy._symbols.attributes import AttributeMixin
 from gamspy._symbols.symbol import Symbol
 
 if TYPE_CHECKING:
     from gamspy import Set, Variable, Container
+    from gamspy._symbols.implicits import ImplicitParameter
     from gamspy._algebra.operation import Operation
     from gamspy._algebra.expression import Expression
 
@@ -71,7 +73,7 @@ class EquationType(Enum):
         return self.value
 
 
-class Equation(gt.Equation, operable.Operable, Symbol):
+class Equation(gt.Equation, operable.Operable, Symbol, AttributeMixin):
     """
     Represents an Equation symbol in GAMS.
     https://www.gams.com/latest/docs/UG_Equations.html
@@ -150,7 +152,10 @@ class Equation(gt.Equation, operable.Operable, Symbol):
         type = cast_type(type)
         self._is_dirty = False
         self._is_frozen = False
-        name = validation.validate_name(name)
+        self._synced_records = None
+        self._implicit_attributes: dict[str, ImplicitParameter] = {}
+        if not container._are_names_validated:
+            name = validation.validate_name(name)
 
         super().__init__(
             container,
@@ -166,18 +171,32 @@ class Equation(gt.Equation, operable.Operable, Symbol):
         validation.validate_container(self, self.domain)
 
         self.where = condition.Condition(self)
+        self.container._track_symbol(self)
         self.container._add_statement(self)
         self._definition_domain = definition_domain
         self._init_definition(definition)
 
-        # create attributes
-        self._l, self._m, self._lo, self._up, self._s = self._init_attributes()
-        self._stage = self._create_attr("stage")
-        self._range = self._create_attr("range")
-        self._slacklo = self._create_attr("slacklo")
-        self._slackup = self._create_attr("slackup")
-        self._slack = self._create_attr("slack")
-        self._infeas = self._create_attr("infeas")
+    def _adopt(self) -> None:
+        """
+        Initializes the GAMSPy state of a gams.transfer Equation whose class
+        was changed to Equation without rebuilding it.
+        """
+        validation.validate_name(self.name)
+        self._is_dirty = False
+        self._is_frozen = False
+        self._synced_records = None
+        self._implicit_attributes = {}
+        self.where = condition.Condition(self)
+
+        # Equations of all types are declared as regular equations
+        if self.type in ["leq", "geq"]:
+            self.type = "eq"
+
+        self.modified = True
+        self.container._track_symbol(self)
+        self.container._add_statement(self)
+        self._definition_domain = None
+        self._definition = None
 
     def __hash__(self):
         return id(self)
@@ -218,19 +237,10 @@ class Equation(gt.Equation, operable.Operable, Symbol):
     def __eq__(self, other):  # type: ignore
         return expression.Expression(self, "=e=", other)
 
-    def _init_attributes(self) -> tuple:
-        level = self._create_attr("l")
-        marginal = self._create_attr("m")
-        lower = self._create_attr("lo")
-        upper = self._create_attr("up")
-        scale = self._create_attr("scale")
-        return level, marginal, lower, upper, scale
-
     def _create_attr(self, attr_name):
         return implicits.ImplicitParameter(
             self,
             name=f"{self.name}.{attr_name}",
-            records=self.records,
             domain=self.domain,
         )
 
@@ -270,7 +280,6 @@ class Equation(gt.Equation, operable.Operable, Symbol):
         assignment = assignment == 0
 
         if self.type in non_regular_map.keys():
-            assignment.replace(assignment.data, non_regular_map[self.type])
             assignment.data = non_regular_map[self.type]
 
         return assignment
@@ -284,7 +293,7 @@ class Equation(gt.Equation, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._l
+        return self._get_attr("l")
 
     @property
     def m(self):
@@ -295,7 +304,7 @@ class Equation(gt.Equation, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._m
+        return self._get_attr("m")
 
     @property
     def lo(self):
@@ -306,7 +315,7 @@ class Equation(gt.Equation, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._lo
+        return self._get_attr("lo")
 
     @property
     def up(self):
@@ -317,7 +326,7 @@ class Equation(gt.Equation, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._up
+        return self._get_attr("up")
 
     @property
     def scale(self):
@@ -328,7 +337,7 @@ class Equation(gt.Equation, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._s
+        return self._get_attr("scale")
 
     @property
     def stage(self):
@@ -339,7 +348,7 @@ class Equation(gt.Equation, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._stage
+        return self._get_attr("stage")
 
     @property
     def range(self):
@@ -350,7 +359,7 @@ class Equation(gt.Equation, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._range
+        return self._get_attr("range")
 
     @property
     def slacklo(self):
@@ -361,7 +370,7 @@ class Equation(gt.Equation, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._slacklo
+        return self._get_attr("slacklo")
 
     @property
     def slackup(self):
@@ -372,7 +381,7 @@ class Equation(gt.Equation, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._slackup
+        return self._get_attr("slackup")
 
     @property
     def slack(self):
@@ -383,7 +392,7 @@ class Equation(gt.Equation, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._slack
+        return self._get_attr("slack")
 
     @property
     def infeas(self):
@@ -394,7 +403,23 @@ class Equation(gt.Equation, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._infeas
+        return self._get_attr("infeas")
+
+    @property
+    def modified(self) -> bool:
+        """
+        Whether the Equation was modified since it was last sent to GAMS
+
+        Returns
+        -------
+        bool
+        """
+        return gt.Equation.modified.fget(self)
+
+    @modified.setter
+    def modified(self, modified: bool) -> None:
+        gt.Equation.modified.fset(self, modified)
+        self._update_modified_state()
 
     @property
     def records(self):
@@ -405,6 +430,8 @@ class Equation(gt.Equation, operable.Operable, Symbol):
         -------
         DataFrame
         """
+        self._load_deferred_records()
+
         if not self._is_dirty:
             return self._records
 
@@ -420,6 +447,7 @@ class Equation(gt.Equation, operable.Operable, Symbol):
 
         # set records
         self._records = records
+        self.container._drop_deferred_records(self.name)
 
         self._requires_state_check = True
         self.modified = True
@@ -29,6 +29,7 @@ from typing import TYPE_CHECKING
 import gamspy._symbols.alias as alias
 import gamspy._symbols.implicits as implicits
 import gamspy._symbols.set as gams_set
+from gamspy._symbols.attributes import AttributeMixin
 from gamspy._symbols.implicits.implicit_parameter import ImplicitParameter
 from gamspy._symbols.implicits.implicit_symbol import ImplicitSymbol
 
@@ -36,7 +37,7 @@ if TYPE_CHECKING:
     from gamspy import Set, Equation
 
 
-class ImplicitEquation(ImplicitSymbol):
+class ImplicitEquation(ImplicitSymbol, AttributeMixin):
     def __init__(
         self,
         parent: Equation,
@@ -55,71 +56,56 @@ class ImplicitEquation(ImplicitSymbol):
         super().__init__(parent, name, domain)
         self.type = type
 
-        # level, marginal, lower, upper, scale
-        self._l, self._m, self._lo, self._up, self._s = self._init_attributes()
-        self._stage = self._create_attr("stage")
-        self._range = self._create_attr("range")
-        self._slacklo = self._create_attr("slacklo")
-        self._slackup = self._create_attr("slackup")
-        self._slack = self._create_attr("slack")
-        self._infeas = self._create_attr("infeas")
+        self._implicit_attributes: dict[str, ImplicitParameter] = {}
 
     def _create_attr(self, attr_name: str):
         return ImplicitParameter(self.parent, f"{self.gamsRepr()}.{attr_name}")
 
-    def _init_attributes(self) -> tuple:
-        level = self._create_attr("l")
-        marginal = self._create_attr("m")
-        lower = self._create_attr("lo")
-        upper = self._create_attr("up")
-        scale = self._create_attr("scale")
-        return level, marginal, lower, upper, scale
-
     @property
     def l(self) -> ImplicitParameter:  # noqa: E741, E743
-        return self._l
+        return self._get_attr("l")
 
     @property
     def m(self) -> ImplicitParameter:
-        return self._m
+        return self._get_attr("m")
 
     @property
     def lo(self) -> ImplicitParameter:
-        return self._lo
+        return self._get_attr("lo")
 
     @property
     def up(self) -> ImplicitParameter:
-        return self._up
+        return self._get_attr("up")
 
     @property
     def scale(self) -> ImplicitParameter:
-        return self._s
+        return self._get_attr("scale")
 
     @property
     def stage(self) -> ImplicitParameter:
-        return self._stage
+        return self._get_attr("stage")
 
     @property
     def range(self) -> ImplicitParameter:
-        return self._range
+        return self._get_attr("range")
 
     @property
     def slacklo(self) -> ImplicitParameter:
-        return self._slacklo
+        return self._get_attr("slacklo")
 
     @property
     def slackup(self) -> ImplicitParameter:
-        return self._slackup
+        return self._get_attr("slackup")
 
     @property
     def slack(self) -> ImplicitParameter:
-        return self._slack
+        return self._get_attr("slack")
 
     @property
     def infeas(self) -> ImplicitParameter:
-        return self._infeas
+        return self._get_attr("infeas")
 
-    def gamsRepr(self) -> str:
+    def _create_representation(self) -> str:
         representation = f"{self.name}"
         if len(self.domain):
             set_strs = []
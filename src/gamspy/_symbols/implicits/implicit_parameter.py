@@ -27,16 +27,28 @@ from __future__ import annotations
 from typing import Any
 from typing import TYPE_CHECKING
 
+import gamspy as gp
 import gamspy._algebra.expression as expression
 import gamspy._algebra.operable as operable
 import gamspy._validation as validation
 import gamspy.utils as utils
 from gamspy._symbols.implicits.implicit_symbol import ImplicitSymbol
+from gamspy.exceptions import ValidationError
 
 if TYPE_CHECKING:
     from gamspy import Set, Parameter, Variable, Equation
+    import numpy as np
     from gamspy._algebra.expression import Expression
 
+# Columns of the records of variables and equations by attribute name
+ATTRIBUTE_COLUMNS = {
+    "l": "level",
+    "m": "marginal",
+    "lo": "lower",
+    "up": "upper",
+    "scale": "scale",
+}
+
 
 class ImplicitParameter(ImplicitSymbol, operable.Operable):
     def __init__(
@@ -116,12 +128,54 @@ class ImplicitParameter(ImplicitSymbol, operable.Operable):
     def __ne__(self, other):  # type: ignore
         return expression.Expression(self, "ne", other)
 
-    def gamsRepr(self) -> str:
-        """Representation of the parameter in GAMS syntax.
+    def toDense(self) -> np.ndarray | None:
+        """
+        Dense array of the records of the parameter or of the attribute of
+        a variable or an equation over the records of its domain sets.
+
+        Returns
+        -------
+        np.ndarray | None
+            None if the parent symbol has no records.
+
+        Raises
+        ------
+        ValidationError
+            In case the implicit parameter is not a parameter or an
+            attribute over the whole domain of its parent.
+
+        Examples
+        --------
+        >>> import gamspy as gp
+        >>> m = gp.Container()
+        >>> i = gp.Set(m, "i", records=['i1','i2'])
+        >>> x = gp.Variable(m, "x", domain=[i])
+        >>> level = x.l.toDense() # doctest: +SKIP
 
-        Returns:
-            str: String representation of the parameter in GAMS syntax.
         """
+        parent_name, _, attribute = self.name.partition(".")
+        is_whole_domain = len(self.domain) == len(self.parent.domain) and all(
+            set is parent_set
+            for set, parent_set in zip(self.domain, self.parent.domain)
+        )
+        if parent_name == self.parent.name and is_whole_domain:
+            if not attribute and isinstance(self.parent, gp.Parameter):
+                return self.parent.toDense()
+
+            if attribute in ATTRIBUTE_COLUMNS and isinstance(
+                self.parent, (gp.Variable, gp.Equation)
+            ):
+                return self.parent.toDense(
+                    column=ATTRIBUTE_COLUMNS[attribute]
+                )
+
+        raise ValidationError(
+            f"`{self.gamsRepr()}` cannot be converted to a dense array. Only"
+            " parameters and the l, m, lo, up and scale attributes of"
+            " variables and equations over their whole domain can."
+        )
+
+    def _create_representation(self) -> str:
         representation = self.name
         if self.domain:
             representation += utils._get_domain_str(self.domain)
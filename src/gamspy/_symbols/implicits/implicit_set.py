@@ -68,7 +68,7 @@ class ImplicitSet(ImplicitSymbol, operable.Operable):
     def dimension(self):
         return self.parent.dimension
 
-    def gamsRepr(self) -> str:
+    def _create_representation(self) -> str:
         representation = self.name
 
         if self.domain != ["*"]:
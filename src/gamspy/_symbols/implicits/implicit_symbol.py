@@ -12,6 +12,22 @@ class ImplicitSymbol(ABC):
         self.name = name
         self.domain = domain
         self.where = condition.Condition(self)
+        self._representation: str | None = None
 
-    def gamsRepr(self):
-        """Representation of the implicit symbol in GAMS"""
+    def _create_representation(self) -> str:
+        """Renders the representation of the implicit symbol in GAMS"""
+
+    def gamsRepr(self) -> str:
+        """
+        Representation of the implicit symbol in GAMS. Implicit symbols
+        do not change after their creation, so the representation is
+        rendered once and reused in all expressions that contain them.
+
+        Returns
+        -------
+        str
+        """
+        if self._representation is None:
+            self._representation = self._create_representation()
+
+        return self._representation
@@ -30,14 +30,16 @@ import gamspy._algebra.expression as expression
 import gamspy._algebra.operable as operable
 import gamspy._symbols.implicits as implicits
 import gamspy.utils as utils
+from gamspy._symbols.attributes import AttributeMixin
 from gamspy._symbols.implicits.implicit_symbol import ImplicitSymbol
 
 if TYPE_CHECKING:
     from gams.transfer import Variable
     from gams.transfer import Set
+    from gamspy._symbols.implicits import ImplicitParameter
 
 
-class ImplicitVariable(ImplicitSymbol, operable.Operable):
+class ImplicitVariable(ImplicitSymbol, operable.Operable, AttributeMixin):
     """
     Implicit Variable
 
@@ -55,55 +57,44 @@ class ImplicitVariable(ImplicitSymbol, operable.Operable):
         domain: list[Set | str],
     ):
         super().__init__(parent, name, domain)
-        self._l, self._m, self._lo, self._up, self._s = self._init_attributes()
-        self._fx = self._create_attr("fx")
-        self._prior = self._create_attr("prior")
-        self._stage = self._create_attr("stage")
+        self._implicit_attributes: dict[str, ImplicitParameter] = {}
 
     def _create_attr(self, attr_name: str):
         return implicits.ImplicitParameter(
             self.parent, f"{self.gamsRepr()}.{attr_name}"
         )
 
-    def _init_attributes(self):
-        level = self._create_attr("l")
-        marginal = self._create_attr("m")
-        lower = self._create_attr("lo")
-        upper = self._create_attr("up")
-        scale = self._create_attr("scale")
-        return level, marginal, lower, upper, scale
-
     @property
     def l(self) -> implicits.ImplicitParameter:  # noqa: E741, E743
-        return self._l
+        return self._get_attr("l")
 
     @property
     def m(self) -> implicits.ImplicitParameter:
-        return self._m
+        return self._get_attr("m")
 
     @property
     def lo(self) -> implicits.ImplicitParameter:
-        return self._lo
+        return self._get_attr("lo")
 
     @property
     def up(self) -> implicits.ImplicitParameter:
-        return self._up
+        return self._get_attr("up")
 
     @property
     def scale(self) -> implicits.ImplicitParameter:
-        return self._s
+        return self._get_attr("scale")
 
     @property
     def fx(self) -> implicits.ImplicitParameter:
-        return self._fx
+        return self._get_attr("fx")
 
     @property
     def prior(self) -> implicits.ImplicitParameter:
-        return self._prior
+        return self._get_attr("prior")
 
     @property
     def stage(self) -> implicits.ImplicitParameter:
-        return self._stage
+        return self._get_attr("stage")
 
     def __neg__(self):
         return implicits.ImplicitVariable(
@@ -116,7 +107,7 @@ class ImplicitVariable(ImplicitSymbol, operable.Operable):
     def __ne__(self, other):  # type: ignore
         return expression.Expression(self, "ne", other)
 
-    def gamsRepr(self) -> str:
+    def _create_representation(self) -> str:
         representation = self.name
         if self.domain:
             representation += utils._get_domain_str(self.domain)
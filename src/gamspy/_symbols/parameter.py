@@ -24,6 +24,7 @@
 #
 from __future__ import annotations
 
+import os
 from typing import Any
 from typing import List
 from typing import Optional
@@ -31,16 +32,19 @@ from typing import TYPE_CHECKING
 from typing import Union
 
 import gams.transfer as gt
+import numpy as np
 import pandas as pd
 
 import gamspy as gp
 import gamspy._algebra.condition as condition
+import gamspy._algebra.evaluator as evaluator
 import gamspy._algebra.expression as expression
 import gamspy._algebra.operable as operable
 import gamspy._symbols.implicits as implicits
 import gamspy._validation as validation
 import gamspy.utils as utils
 from gamspy._symbols.symbol import Symbol
+from gamspy.exceptions import ValidationError
 
 if TYPE_CHECKING:
     from gamspy import Set, Container
@@ -114,7 +118,10 @@ class Parameter(gt.Parameter, operable.Operable, Symbol):
     ):
         self._is_dirty = False
         self._is_frozen = False
-        name = validation.validate_name(name)
+        self._synced_records = None
+        self._records_file: tuple[str, int] | None = None
+        if not container._are_names_validated:
+            name = validation.validate_name(name)
 
         super().__init__(
             container,
@@ -128,6 +135,22 @@ class Parameter(gt.Parameter, operable.Operable, Symbol):
 
         validation.validate_container(self, self.domain)
         self.where = condition.Condition(self)
+        self.container._track_symbol(self)
+        self.container._add_statement(self)
+
+    def _adopt(self) -> None:
+        """
+        Initializes the GAMSPy state of a gams.transfer Parameter whose
+        class was changed to Parameter without rebuilding it.
+        """
+        validation.validate_name(self.name)
+        self._is_dirty = False
+        self._is_frozen = False
+        self._synced_records = None
+        self._records_file = None
+        self.where = condition.Condition(self)
+        self.modified = True
+        self.container._track_symbol(self)
         self.container._add_statement(self)
 
     def __getitem__(
@@ -158,6 +181,13 @@ class Parameter(gt.Parameter, operable.Operable, Symbol):
         if isinstance(assignment, float):
             assignment = utils._map_special_values(assignment)  # type: ignore
 
+        if (
+            not self._is_dirty
+            and self.container._can_evaluate_locally()
+            and evaluator.assign(self, domain, assignment)
+        ):
+            return
+
         statement = expression.Expression(
             implicits.ImplicitParameter(self, name=self.name, domain=domain),
             "=",
@@ -178,6 +208,260 @@ class Parameter(gt.Parameter, operable.Operable, Symbol):
             self, name=f"-{self.name}", domain=self._domain
         )
 
+    @classmethod
+    def fromCoo(
+        cls,
+        container: Container,
+        name: str,
+        domain: List[Set],
+        indices: Any,
+        values: Any,
+        description: str = "",
+    ) -> Parameter:
+        """
+        Creates a Parameter from integer positions into the records of the
+        domain sets and the values at these positions. The labels of the
+        records are not created element by element, which makes this
+        considerably faster than passing a DataFrame for large parameters.
+
+        Parameters
+        ----------
+        container : Container
+        name : str
+        domain : list[Set]
+        indices : Sequence[array_like]
+            One integer array per domain set. The k-th array contains the
+            positions of the records of the k-th domain set.
+        values : array_like
+            Values of the records. Must be as long as each index array.
+        description : str, optional
+
+        Returns
+        -------
+        Parameter
+
+        Raises
+        ------
+        ValidationError
+            In case the indices do not match the domain or the values.
+
+        Examples
+        --------
+        >>> import gamspy as gp
+        >>> m = gp.Container()
+        >>> i = gp.Set(m, "i", records=['i1','i2'])
+        >>> j = gp.Set(m, "j", records=['j1','j2'])
+        >>> a = gp.Parameter.fromCoo(m, "a", [i, j], [[0, 1], [1, 1]], [3, 4])
+        >>> a.records.values.tolist()
+        [['i1', 'j2', 3.0], ['i2', 'j2', 4.0]]
+
+        """
+        domain = domain if isinstance(domain, (list, tuple)) else [domain]
+        columns = _get_coo_columns(name, domain, indices, values)
+
+        parameter = cls(container, name, domain, description=description)
+        parameter._set_coo_columns(columns)
+
+        return parameter
+
+    @classmethod
+    def fromDense(
+        cls,
+        container: Container,
+        name: str,
+        domain: List[Set],
+        array: Any,
+        description: str = "",
+    ) -> Parameter:
+        """
+        Creates a Parameter from a dense array over the records of the
+        domain sets. Zeros are not stored as records while negative zeros
+        are stored as EPS.
+
+        Parameters
+        ----------
+        container : Container
+        name : str
+        domain : list[Set]
+        array : array_like
+            Array with one axis per domain set where the length of the k-th
+            axis is the number of records of the k-th domain set.
+        description : str, optional
+
+        Returns
+        -------
+        Parameter
+
+        Raises
+        ------
+        ValidationError
+            In case the shape of the array does not match the domain.
+
+        Examples
+        --------
+        >>> import gamspy as gp
+        >>> m = gp.Container()
+        >>> i = gp.Set(m, "i", records=['i1','i2'])
+        >>> a = gp.Parameter.fromDense(m, "a", [i], [0, 5])
+        >>> a.records.values.tolist()
+        [['i2', 5.0]]
+
+        """
+        domain = domain if isinstance(domain, (list, tuple)) else [domain]
+        array = np.asarray(array, dtype=float)
+
+        shape = tuple(
+            len(_get_domain_uels(name, domain_set)) for domain_set in domain
+        )
+        if array.shape != shape:
+            raise ValidationError(
+                f"Shape of the array {array.shape} does not match the"
+                f" number of records of the domain sets {shape}"
+            )
+
+        # Negative zeros are EPS values, which are stored as records
+        indices = np.nonzero((array != 0) | np.signbit(array))
+        columns = _get_coo_columns(name, domain, indices, array[indices])
+
+        parameter = cls(container, name, domain, description=description)
+        parameter._set_coo_columns(columns)
+
+        return parameter
+
+    @classmethod
+    def fromFile(
+        cls,
+        container: Container,
+        name: str,
+        domain: List[Union[str, Set]],
+        path: str,
+        description: str = "",
+        chunk_size: int = 1_000_000,
+    ) -> Parameter:
+        """
+        Creates a Parameter whose records stay in an Arrow IPC (Feather) or
+        Parquet file. The file must have one label column per domain set
+        followed by a value column. Records are streamed to GAMS in chunks
+        of chunk_size rows, so they are never fully held in memory. They
+        are only read into memory if the records are accessed.
+
+        Parameters
+        ----------
+        container : Container
+        name : str
+        domain : list[str | Set]
+        path : str
+            Path to the Arrow IPC or Parquet (.parquet, .pq) file
+        description : str, optional
+        chunk_size : int, optional
+            Maximum number of records that are in memory at once while
+            they are sent to GAMS, by default 1000000
+
+        Returns
+        -------
+        Parameter
+
+        Raises
+        ------
+        ValidationError
+            In case the columns of the file do not match the domain or the
+            chunk size is not positive.
+
+        Examples
+        --------
+        >>> import gamspy as gp
+        >>> m = gp.Container()
+        >>> i = gp.Set(m, "i", records=['i1','i2'])
+        >>> a = gp.Parameter.fromFile( # doctest: +SKIP
+        ...     m, "a", [i], "a.parquet"
+        ... )
+
+        """
+        domain = domain if isinstance(domain, (list, tuple)) else [domain]
+        _validate_records_file(name, len(domain), path, chunk_size)
+
+        parameter = cls(container, name, domain, description=description)
+        parameter.records = None
+        parameter._records_file = (os.path.abspath(path), chunk_size)
+
+        return parameter
+
+    def _load_records_file(self) -> None:
+        """Reads the records that are still in a file into memory"""
+        if self._records_file is None:
+            return
+
+        path, chunk_size = self._records_file
+        chunks = list(utils._iter_file_chunks(path, chunk_size))
+        modified = self.modified
+
+        self.setRecords(
+            pd.concat(chunks, ignore_index=True) if chunks else None
+        )
+        self.modified = modified
+
+    def _write_records_file(self, directory: str) -> list[str]:
+        """
+        Writes the records of the file to gdx files of at most chunk_size
+        records each and returns their paths in order. There is always at
+        least one gdx file so that the records on the GAMS side are
+        replaced even if the file is empty.
+        """
+        path, chunk_size = self._records_file  # type: ignore
+        paths = []
+
+        def write_chunk(records: pd.DataFrame | None):
+            container = gt.Container(
+                system_directory=self.container.system_directory
+            )
+            gt.Parameter(
+                container, self.name, self.domain_names, records=records
+            )
+
+            chunk_path = os.path.join(
+                directory, f"_{self.name}_chunk_{len(paths)}.gdx"
+            )
+            container.write(chunk_path)
+            paths.append(chunk_path)
+
+        for chunk in utils._iter_file_chunks(path, chunk_size):
+            write_chunk(chunk)
+
+        if not paths:
+            write_chunk(None)
+
+        return paths
+
+    def _set_coo_records(self, indices: Any, values: Any) -> None:
+        self._set_coo_columns(
+            _get_coo_columns(self.name, self.domain, indices, values)
+        )
+
+    def _set_coo_columns(self, columns: list) -> None:
+        records = {
+            label: column
+            for label, column in zip(self.domain_labels, columns[:-1])
+        }
+        records["value"] = columns[-1]
+        self.records = pd.DataFrame(records)
+        self.container._share_labels([self.name])
+
+    @property
+    def modified(self) -> bool:
+        """
+        Whether the Parameter was modified since it was last sent to GAMS
+
+        Returns
+        -------
+        bool
+        """
+        return gt.Parameter.modified.fget(self)
+
+    @modified.setter
+    def modified(self, modified: bool) -> None:
+        gt.Parameter.modified.fset(self, modified)
+        self._update_modified_state()
+
     @property
     def records(self):
         """
@@ -187,6 +471,9 @@ class Parameter(gt.Parameter, operable.Operable, Symbol):
         -------
         DataFrame
         """
+        self._load_deferred_records()
+        self._load_records_file()
+
         if not self._is_dirty:
             return self._records
 
@@ -202,6 +489,8 @@ class Parameter(gt.Parameter, operable.Operable, Symbol):
 
         # set records
         self._records = records
+        self._records_file = None
+        self.container._drop_deferred_records(self.name)
 
         self._requires_state_check = True
         self.modified = True
@@ -247,3 +536,79 @@ class Parameter(gt.Parameter, operable.Operable, Symbol):
         output += ";"
 
         return output
+
+
+def _validate_records_file(
+    name: str, dimension: int, path: str, chunk_size: int
+) -> None:
+    if chunk_size < 1:
+        raise ValidationError("`chunk_size` must be a positive integer")
+
+    columns = utils._get_file_columns(path)
+    if len(columns) != dimension + 1:
+        raise ValidationError(
+            f"Parameter `{name}` needs {dimension + 1} columns (labels and"
+            f" value) but `{path}` has {len(columns)}"
+        )
+
+
+def _get_domain_uels(name: str, domain_set: Set | str) -> np.ndarray:
+    if isinstance(domain_set, str):
+        raise ValidationError(
+            f"Domain `{domain_set}` of Parameter `{name}` must be a Set or"
+            " an Alias to construct records from positions"
+        )
+
+    records = domain_set.records
+    if records is None:
+        return np.array([], dtype=object)
+
+    return records.iloc[:, 0].to_numpy(dtype=object)
+
+
+def _get_coo_columns(
+    name: str, domain: list, indices: Any, values: Any
+) -> list:
+    """
+    Validates the positions into the records of the domain sets and
+    returns one categorical column per domain set followed by the values.
+    """
+    values = np.asarray(values, dtype=float).ravel()
+    indices = [np.asarray(index).ravel() for index in indices]
+
+    if len(indices) != len(domain):
+        raise ValidationError(
+            f"Parameter `{name}` has {len(domain)} dimensions but"
+            f" {len(indices)} index arrays were given"
+        )
+
+    columns: list = []
+    for position, (index, domain_set) in enumerate(zip(indices, domain)):
+        if len(index) != len(values):
+            raise ValidationError(
+                f"Index array {position} has {len(index)} elements but"
+                f" {len(values)} values were given"
+            )
+
+        if len(index) and not np.issubdtype(index.dtype, np.integer):
+            raise ValidationError(
+                f"Index array {position} must contain integers but found"
+                f" {index.dtype}"
+            )
+
+        uels = _get_domain_uels(name, domain_set)
+        if len(index) and (index.min() < 0 or index.max() >= len(uels)):
+            raise ValidationError(
+                f"Index array {position} contains positions outside of the"
+                f" {len(uels)} records of domain `{domain_set.name}`"
+            )
+
+        columns.append(
+            pd.Categorical.from_codes(
+                index.astype(int), categories=uels, ordered=True
+            )
+        )
+
+    columns.append(values)
+
+    return columns
@@ -368,7 +368,8 @@ class Set(gt.Set, operable.Operable, Symbol, SetMixin):
     ):
         self._is_dirty = False
         self.where = condition.Condition(self)
-        name = validation.validate_name(name)
+        if not container._are_names_validated:
+            name = validation.validate_name(name)
 
         singleton_check(is_singleton, records)
 
@@ -384,6 +385,20 @@ class Set(gt.Set, operable.Operable, Symbol, SetMixin):
         )
 
         validation.validate_container(self, self.domain)
+        self.container._track_symbol(self)
+        self.container._add_statement(self)
+        self._current_index = 0
+
+    def _adopt(self) -> None:
+        """
+        Initializes the GAMSPy state of a gams.transfer Set whose class was
+        changed to Set without rebuilding it.
+        """
+        validation.validate_name(self.name)
+        self._is_dirty = False
+        self.where = condition.Condition(self)
+        self.modified = True
+        self.container._track_symbol(self)
         self.container._add_statement(self)
         self._current_index = 0
 
@@ -450,6 +465,22 @@ class Set(gt.Set, operable.Operable, Symbol, SetMixin):
         if not self.container.delayed_execution:
             self.container._run()
 
+    @property
+    def modified(self) -> bool:
+        """
+        Whether the Set was modified since it was last sent to GAMS
+
+        Returns
+        -------
+        bool
+        """
+        return gt.Set.modified.fget(self)
+
+    @modified.setter
+    def modified(self, modified: bool) -> None:
+        gt.Set.modified.fset(self, modified)
+        self._update_modified_state()
+
     @property
     def records(self):
         """
@@ -459,6 +490,8 @@ class Set(gt.Set, operable.Operable, Symbol, SetMixin):
         -------
         DataFrame
         """
+        self._load_deferred_records()
+
         if not self._is_dirty:
             return self._records
 
@@ -474,6 +507,7 @@ class Set(gt.Set, operable.Operable, Symbol, SetMixin):
 
         # set records
         self._records = records
+        self.container._drop_deferred_records(self.name)
 
         self._requires_state_check = True
         self.modified = True
@@ -3,9 +3,11 @@ from __future__ import annotations
 from typing import TYPE_CHECKING
 
 import gams.transfer as gt
+import pandas as pd
 
 import gamspy as gp
 import gamspy._symbols.implicits as implicits
+import gamspy.utils as utils
 from gamspy.exceptions import ValidationError
 
 if TYPE_CHECKING:
@@ -13,6 +15,119 @@ if TYPE_CHECKING:
 
 
 class Symbol:
+    @property
+    def _is_dirty(self) -> bool:
+        """Whether GAMS changed the records since they were last loaded"""
+        return self._dirty
+
+    @_is_dirty.setter
+    def _is_dirty(self, is_dirty: bool) -> None:
+        self._dirty = is_dirty
+
+        container = getattr(self, "container", None)
+        if container is not None:
+            container._update_dirty_state(self)
+
+    def _update_modified_state(self) -> None:
+        container = getattr(self, "container", None)
+        if container is not None:
+            container._update_modified_state(self)
+
+    def _sync_records(self) -> None:
+        """
+        Keeps a snapshot of the records that GAMS has so that the next
+        transfer can only send the records that changed in between.
+        """
+        records = self._records
+        if (
+            records is not None
+            and len(records) >= utils.DELTA_TRANSFER_THRESHOLD
+        ):
+            self._synced_records = utils._RecordsSnapshot(
+                records, self.dimension
+            )
+        else:
+            self._synced_records = None
+
+    def _load_deferred_records(self) -> None:
+        """
+        Waits for the solve in the background that changes the symbol and
+        loads the records of the symbol if their loading was deferred.
+        """
+        if self.name in self.container._pending_symbols:
+            self.container._wait_for_pending_run()
+
+        deferred = self.container._deferred_symbols.get(self.name)
+        if deferred is not None and deferred[0] is self:
+            self.container._load_deferred_records([self.name])
+
+    def toArrow(self, columns: list[str] | None = None):
+        """
+        Records of the symbol as a pyarrow Table. Domain columns become
+        dictionary arrays that reuse the category codes of the records
+        and numeric columns share the buffers of the records.
+
+        Parameters
+        ----------
+        columns : list[str], optional
+            Columns of the records to export. All columns by default.
+
+        Returns
+        -------
+        pyarrow.Table | None
+            None if the symbol has no records.
+
+        Raises
+        ------
+        ModuleNotFoundError
+            In case pyarrow is not installed.
+        ValidationError
+            In case a column does not exist in the records.
+
+        Examples
+        --------
+        >>> import gamspy as gp
+        >>> m = gp.Container()
+        >>> i = gp.Set(m, "i", records=['i1','i2'])
+        >>> a = gp.Parameter(m, "a", [i], records=[['i1',1],['i2',2]])
+        >>> table = a.toArrow() # doctest: +SKIP
+
+        """
+        try:
+            import pyarrow as pa
+        except ModuleNotFoundError as e:
+            e.msg = "You must first install pyarrow to use this functionality"
+            raise e
+
+        records = self.records
+        if records is None:
+            return None
+
+        if columns is None:
+            columns = records.columns.tolist()
+
+        arrays = []
+        for column in columns:
+            if column not in records.columns:
+                raise ValidationError(
+                    f"`{column}` is not a column of the records of"
+                    f" `{self.name}`. Available columns:"
+                    f" {records.columns.tolist()}"
+                )
+
+            series = records[column]
+            if isinstance(series.dtype, pd.CategoricalDtype):
+                arrays.append(
+                    pa.DictionaryArray.from_arrays(
+                        series.cat.codes.to_numpy(),
+                        series.cat.categories.to_numpy(dtype=object),
+                    )
+                )
+            else:
+                arrays.append(pa.array(series.to_numpy()))
+
+        return pa.Table.from_arrays(arrays, names=columns)
+
     def gamsRepr(self):
         """Representation of the symbol in GAMS"""
 
@@ -74,6 +74,16 @@ class UniverseAlias(gt.UniverseAlias):
         # iterator index
         self._current_index = 0
 
+    def _adopt(self) -> None:
+        """
+        Initializes the GAMSPy state of a gams.transfer UniverseAlias whose
+        class was changed to UniverseAlias without rebuilding it.
+        """
+        validation.validate_name(self.name)
+        self.where = condition.Condition(self)
+        self.container._add_statement(self)
+        self._current_index = 0
+
     def __len__(self):
         if not self.records.empty:
             return len(self.records.index)
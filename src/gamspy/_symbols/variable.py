@@ -38,10 +38,12 @@ import gamspy._algebra.operable as operable
 import gamspy._symbols.implicits as implicits
 import gamspy._validation as validation
 import gamspy.utils as utils
+from gamspy._symbols.attributes import AttributeMixin
 from gamspy._symbols.symbol import Symbol
 
 if TYPE_CHECKING:
     from gamspy import Set, Container
+    from gamspy._symbols.implicits import ImplicitParameter
 
 
 class VariableType(Enum):
@@ -63,7 +65,7 @@ class VariableType(Enum):
         return self.value
 
 
-class Variable(gt.Variable, operable.Operable, Symbol):
+class Variable(gt.Variable, operable.Operable, Symbol, AttributeMixin):
     """
     Represents a variable symbol in GAMS.
     https://www.gams.com/latest/docs/UG_Variables.html
@@ -132,7 +134,10 @@ class Variable(gt.Variable, operable.Operable, Symbol):
         type = cast_type(type)
         self._is_dirty = False
         self._is_frozen = False
-        name = validation.validate_name(name)
+        self._synced_records = None
+        self._implicit_attributes: dict[str, ImplicitParameter] = {}
+        if not container._are_names_validated:
+            name = validation.validate_name(name)
 
         super().__init__(
             container,
@@ -147,13 +152,23 @@ class Variable(gt.Variable, operable.Operable, Symbol):
 
         validation.validate_container(self, self.domain)
         self.where = condition.Condition(self)
+        self.container._track_symbol(self)
         self.container._add_statement(self)
 
-        # create attributes
-        self._l, self._m, self._lo, self._up, self._s = self._init_attributes()
-        self._fx = self._create_attr("fx")
-        self._prior = self._create_attr("prior")
-        self._stage = self._create_attr("stage")
+    def _adopt(self) -> None:
+        """
+        Initializes the GAMSPy state of a gams.transfer Variable whose class
+        was changed to Variable without rebuilding it.
+        """
+        validation.validate_name(self.name)
+        self._is_dirty = False
+        self._is_frozen = False
+        self._synced_records = None
+        self._implicit_attributes = {}
+        self.where = condition.Condition(self)
+        self.modified = True
+        self.container._track_symbol(self)
+        self.container._add_statement(self)
 
     def __getitem__(self, indices: tuple | str) -> implicits.ImplicitVariable:
         domain = (
@@ -173,20 +188,11 @@ class Variable(gt.Variable, operable.Operable, Symbol):
     def __eq__(self, other):  # type: ignore
         return expression.Expression(self, "=e=", other)
 
-    def _init_attributes(self):
-        level = self._create_attr("l")
-        marginal = self._create_attr("m")
-        lower = self._create_attr("lo")
-        upper = self._create_attr("up")
-        scale = self._create_attr("scale")
-        return level, marginal, lower, upper, scale
-
     def _create_attr(self, attr_name):
         domain = self.domain
         return implicits.ImplicitParameter(
             self,
             name=f"{self.name}.{attr_name}",
-            records=self.records,
             domain=domain,
         )
 
@@ -199,7 +205,7 @@ class Variable(gt.Variable, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._l
+        return self._get_attr("l")
 
     @property
     def m(self):
@@ -210,7 +216,7 @@ class Variable(gt.Variable, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._m
+        return self._get_attr("m")
 
     @property
     def lo(self):
@@ -221,7 +227,7 @@ class Variable(gt.Variable, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._lo
+        return self._get_attr("lo")
 
     @property
     def up(self):
@@ -232,7 +238,7 @@ class Variable(gt.Variable, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._up
+        return self._get_attr("up")
 
     @property
     def scale(self):
@@ -243,7 +249,7 @@ class Variable(gt.Variable, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._s
+        return self._get_attr("scale")
 
     @property
     def fx(self):
@@ -254,7 +260,7 @@ class Variable(gt.Variable, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._fx
+        return self._get_attr("fx")
 
     @property
     def prior(self):
@@ -265,7 +271,7 @@ class Variable(gt.Variable, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._prior
+        return self._get_attr("prior")
 
     @property
     def stage(self):
@@ -276,7 +282,23 @@ class Variable(gt.Variable, operable.Operable, Symbol):
         -------
         ImplicitParameter
         """
-        return self._stage
+        return self._get_attr("stage")
+
+    @property
+    def modified(self) -> bool:
+        """
+        Whether the Variable was modified since it was last sent to GAMS
+
+        Returns
+        -------
+        bool
+        """
+        return gt.Variable.modified.fget(self)
+
+    @modified.setter
+    def modified(self, modified: bool) -> None:
+        gt.Variable.modified.fset(self, modified)
+        self._update_modified_state()
 
     @property
     def records(self):
@@ -287,6 +309,8 @@ class Variable(gt.Variable, operable.Operable, Symbol):
         -------
         DataFrame
         """
+        self._load_deferred_records()
+
         if not self._is_dirty:
             return self._records
 
@@ -302,6 +326,7 @@ class Variable(gt.Variable, operable.Operable, Symbol):
 
         # set records
         self._records = records
+        self.container._drop_deferred_records(self.name)
 
         self._requires_state_check = True
         self.modified = True
@@ -1,5 +1,6 @@
 from __future__ import annotations
 
+from typing import Iterable
 from typing import List
 from typing import TYPE_CHECKING
 from typing import Union
@@ -12,6 +13,105 @@ if TYPE_CHECKING:
     from gamspy._symbols.implicits import ImplicitSet, ImplicitParameter
     from gamspy import Alias, Set, Parameter, Equation, Variable
 
+RESERVED_WORDS = [
+    "abort",
+    "acronym",
+    "acronyms",
+    "alias",
+    "all",
+    "and",
+    "binary",
+    "break",
+    "card",
+    "continue",
+    "diag",
+    "display",
+    "do",
+    "else",
+    "elseif",
+    "endfor",
+    "endif",
+    "endloop",
+    "endwhile",
+    "eps",
+    "equation",
+    "equations",
+    "execute",
+    "execute_load",
+    "execute_loaddc",
+    "execute_loadhandle",
+    "execute_loadpoint",
+    "execute_unload",
+    "execute_unloaddi",
+    "execute_unloadidx",
+    "file",
+    "files",
+    "for",
+    "free",
+    "function",
+    "functions",
+    "gdxLoad",
+    "if",
+    "inf",
+    "integer",
+    "logic",
+    "loop",
+    "model",
+    "models",
+    "na",
+    "negative",
+    "nonnegative",
+    "no",
+    "not",
+    "option",
+    "options",
+    "or",
+    "ord",
+    "parameter",
+    "parameters",
+    "positive",
+    "prod",
+    "put",
+    "put_utility",
+    "putclear",
+    "putclose",
+    "putfmcl",
+    "puthd",
+    "putheader",
+    "putpage",
+    "puttitle",
+    "puttl",
+    "repeat",
+    "sameas",
+    "sand",
+    "scalar",
+    "scalars",
+    "semicont",
+    "semiint",
+    "set",
+    "sets",
+    "singleton",
+    "smax",
+    "smin",
+    "solve",
+    "sor",
+    "sos1",
+    "sos2",
+    "sum",
+    "system",
+    "table",
+    "tables",
+    "then",
+    "undf",
+    "until",
+    "variable",
+    "variables",
+    "while",
+    "xor",
+    "yes",
+]
+_RESERVED_WORD_SET = frozenset(RESERVED_WORDS)
+
 
 def get_dimension(
     domain: List[Set | Alias | ImplicitSet | str],
@@ -149,108 +249,20 @@ def validate_container(
 
 
 def validate_name(word: str) -> str:
-    reserved_words = [
-        "abort",
-        "acronym",
-        "acronyms",
-        "alias",
-        "all",
-        "and",
-        "binary",
-        "break",
-        "card",
-        "continue",
-        "diag",
-        "display",
-        "do",
-        "else",
-        "elseif",
-        "endfor",
-        "endif",
-        "endloop",
-        "endwhile",
-        "eps",
-        "equation",
-        "equations",
-        "execute",
-        "execute_load",
-        "execute_loaddc",
-        "execute_loadhandle",
-        "execute_loadpoint",
-        "execute_unload",
-        "execute_unloaddi",
-        "execute_unloadidx",
-        "file",
-        "files",
-        "for",
-        "free",
-        "function",
-        "functions",
-        "gdxLoad",
-        "if",
-        "inf",
-        "integer",
-        "logic",
-        "loop",
-        "model",
-        "models",
-        "na",
-        "negative",
-        "nonnegative",
-        "no",
-        "not",
-        "option",
-        "options",
-        "or",
-        "ord",
-        "parameter",
-        "parameters",
-        "positive",
-        "prod",
-        "put",
-        "put_utility",
-        "putclear",
-        "putclose",
-        "putfmcl",
-        "puthd",
-        "putheader",
-        "putpage",
-        "puttitle",
-        "puttl",
-        "repeat",
-        "sameas",
-        "sand",
-        "scalar",
-        "scalars",
-        "semicont",
-        "semiint",
-        "set",
-        "sets",
-        "singleton",
-        "smax",
-        "smin",
-        "solve",
-        "sor",
-        "sos1",
-        "sos2",
-        "sum",
-        "system",
-        "table",
-        "tables",
-        "then",
-        "undf",
-        "until",
-        "variable",
-        "variables",
-        "while",
-        "xor",
-        "yes",
-    ]
-
-    if word.lower() in reserved_words:
+    if word.lower() in _RESERVED_WORD_SET:
         raise ValidationError(
             "Name cannot be one of the reserved words. List of reserved"
-            f" words: {reserved_words}"
+            f" words: {RESERVED_WORDS}"
         )
 
     return word
+
+
+def validate_names(words: Iterable[str]) -> None:
+    """Validates the given names in a single pass"""
+    reserved = _RESERVED_WORD_SET.intersection(word.lower() for word in words)
+    if reserved:
+        raise ValidationError(
+            f"Names {sorted(reserved)} cannot be one of the reserved words."
+            f" List of reserved words: {RESERVED_WORDS}"
+        )
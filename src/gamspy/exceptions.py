@@ -117,14 +117,20 @@ def customize_exception(
         exception.value = error_message
         return exception
 
+    lst_filename = options.output if options.output else job._job_name + ".lst"
+
+    return _get_error_message(
+        workspace._working_directory + os.path.sep + lst_filename,
+        exception.rc,
+    )
+
+
+def _get_error_message(lst_path: str, return_code: int) -> str:
+    error_message = ""
     header = "=" * 80
     footer = "=" * 80
     message_format = "\n\n{header}\nError Summary\n{footer}\n{message}\n"
 
-    lst_filename = options.output if options.output else job._job_name + ".lst"
-
-    lst_path = workspace._working_directory + os.path.sep + lst_filename
-
     with open(lst_path) as lst_file:
         all_lines = lst_file.readlines()
         num_lines = len(all_lines)
@@ -148,15 +154,15 @@ def customize_exception(
                     message="".join(error_lines),
                     header=header,
                     footer=footer,
-                    return_code=exception.rc,
-                    meaning=error_codes[exception.rc],
+                    return_code=return_code,
+                    meaning=error_codes[return_code],
                 )
                 break
 
             index += 1
 
     explanation = (
-        f"\nMeaning of return code {exception.rc}: {error_codes[exception.rc]}"
+        f"\nMeaning of return code {return_code}: {error_codes[return_code]}"
     )
 
     return error_message + explanation
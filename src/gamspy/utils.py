@@ -24,13 +24,18 @@
 #
 from __future__ import annotations
 
+import hashlib
 import os
 import platform
+import shutil
 from collections.abc import Sequence
 from typing import Iterable
+from typing import Iterator
 from typing import TYPE_CHECKING
 
 import gams.transfer as gt
+import numpy as np
+import pandas as pd
 from gams.core import gdx
 
 import gamspy._symbols.implicits as implicits
@@ -51,6 +56,11 @@ SPECIAL_VALUE_MAP = {
     gt.SpecialValues.NEGINF: "-INF",
 }
 
+EQUALITY_SIGN_REPLACEMENTS = (("=l=", "<="), ("=e=", "="), ("=g=", ">="))
+
+# Minimum number of records for a symbol to be transferred to GAMS as delta
+DELTA_TRANSFER_THRESHOLD = 10_000
+
 
 def getInstalledSolvers() -> list[str]:
     """
@@ -96,6 +106,49 @@ def getInstalledSolvers() -> list[str]:
     return sorted(solver_names)
 
 
+def _get_default_solvers() -> dict[str, str]:
+    """
+    Returns the default solver of each problem type, e.g. {"LP": "CPLEX"}
+
+    Returns
+    -------
+    dict[str, str]
+
+    Raises
+    ------
+    GamspyException
+        In case gamspy_base is not installed.
+    """
+    try:
+        import gamspy_base
+    except ModuleNotFoundError as e:
+        e.msg = "You must first install gamspy_base to use this functionality"
+        raise e
+
+    default_solvers = {}
+    capabilities_file = {"Windows": "gmscmpNT.txt", "rest": "gmscmpun.txt"}
+    user_platform = "Windows" if platform.system() == "Windows" else "rest"
+
+    with open(
+        gamspy_base.directory + os.sep + capabilities_file[user_platform]
+    ) as capabilities:
+        is_default_section = False
+        for line in capabilities:
+            if line == "DEFAULTS\n":
+                is_default_section = True
+                continue
+
+            if is_default_section:
+                tokens = line.split()
+                if len(tokens) != 2:
+                    break
+
+                problem, solver = tokens
+                default_solvers[problem.upper()] = solver.upper()
+
+    return default_solvers
+
+
 def getAvailableSolvers() -> list[str]:
     """
     Returns all available solvers that can be installed.
@@ -234,12 +287,103 @@ def _close_gdx_handle(handle):
 
 
 def _replace_equality_signs(string: str) -> str:
-    string = string.replace("=l=", "<=")
-    string = string.replace("=e=", "=")
-    string = string.replace("=g=", ">=")
+    for old, new in EQUALITY_SIGN_REPLACEMENTS:
+        string = string.replace(old, new)
     return string
 
 
+def _link_or_copy(source: str, destination: str) -> None:
+    """
+    Hard links the destination to the source so that both share the same
+    data on disk. Falls back to copying if the file system does not support
+    hard links.
+    """
+    if not os.path.exists(source):
+        raise FileNotFoundError(source)
+
+    if os.path.exists(destination):
+        os.remove(destination)
+
+    try:
+        os.link(source, destination)
+    except OSError:
+        shutil.copy(source, destination)
+
+
+def _get_file_digest(path: str) -> str:
+    """Returns the SHA-256 digest of the content of the file"""
+    digest = hashlib.sha256()
+    with open(path, "rb") as file:
+        for chunk in iter(lambda: file.read(1024 * 1024), b""):
+            digest.update(chunk)
+
+    return digest.hexdigest()
+
+
+def _import_pyarrow():
+    try:
+        import pyarrow as pa
+        import pyarrow.parquet as pq
+    except ModuleNotFoundError as e:
+        e.msg = "You must first install pyarrow to use this functionality"
+        raise e
+
+    return pa, pq
+
+
+def _is_parquet_file(path: str) -> bool:
+    return path.lower().endswith((".parquet", ".pq"))
+
+
+def _get_file_columns(path: str) -> list[str]:
+    """
+    Returns the column names of an Arrow IPC (Feather) or Parquet file
+    without reading its data.
+    """
+    pa, pq = _import_pyarrow()
+
+    if _is_parquet_file(path):
+        return pq.read_schema(path).names
+
+    with pa.memory_map(path) as source:
+        return pa.ipc.open_file(source).schema.names
+
+
+def _iter_file_chunks(path: str, chunk_size: int) -> Iterator[pd.DataFrame]:
+    """
+    Yields the rows of an Arrow IPC (Feather) or Parquet file as
+    DataFrames of at most chunk_size rows. Arrow IPC files are memory
+    mapped, Parquet files are read batch by batch.
+    """
+    pa, pq = _import_pyarrow()
+
+    if _is_parquet_file(path):
+        parquet_file = pq.ParquetFile(path)
+        for batch in parquet_file.iter_batches(batch_size=chunk_size):
+            yield batch.to_pandas()
+
+        return
+
+    with pa.memory_map(path) as source:
+        reader = pa.ipc.open_file(source)
+        for idx in range(reader.num_record_batches):
+            batch = reader.get_batch(idx)
+            for offset in range(0, batch.num_rows, chunk_size):
+                yield batch.slice(offset, chunk_size).to_pandas()
+
+
+def _detach_shared_file(path: str) -> None:
+    """
+    Removes the file if it is hard linked to another file so that
+    overwriting it does not change the data of the other file.
+    """
+    try:
+        if os.stat(path).st_nlink > 1:
+            os.remove(path)
+    except FileNotFoundError:
+        pass
+
+
 def _open_gdx_file(system_directory: str, load_from: str):
     """
     Opens the gdx file with given path
@@ -373,3 +517,152 @@ def _get_matching_paranthesis_indices(string: str) -> dict:
         raise AssertionError("Too many opening parentheses!")
 
     return matching_indices
+
+
+class _RecordsSnapshot:
+    """
+    Compact copy of the records that GAMS has. The domain columns are kept
+    as categorical codes and the values as their bit patterns.
+    """
+
+    def __init__(self, records: pd.DataFrame, dimension: int) -> None:
+        self.columns = list(records.columns)
+        self.categories = []
+        self.codes = []
+        for column in self.columns[:dimension]:
+            values = records[column]
+            if isinstance(values.dtype, pd.CategoricalDtype):
+                self.categories.append(values.cat.categories)
+                self.codes.append(values.cat.codes.to_numpy().copy())
+            else:
+                self.categories.append(None)
+                self.codes.append(None)
+
+        self.bits = _get_value_bits(records, dimension).copy()
+
+    def __len__(self) -> int:
+        return len(self.bits)
+
+
+def _get_value_bits(records: pd.DataFrame, dimension: int) -> np.ndarray:
+    # Compare the bit patterns so that special values (NA, UNDF, EPS) are
+    # considered equal only if they are exactly the same.
+    values = records.iloc[:, dimension:].to_numpy(dtype=np.float64)
+    return np.ascontiguousarray(values).view(np.uint64)
+
+
+def _match_records(
+    old: _RecordsSnapshot, new: pd.DataFrame, dimension: int
+) -> np.ndarray | None:
+    # Encodes the domain of each record as one integer in terms of the
+    # categories of the snapshot and returns the position of each new record
+    # in the snapshot, -1 for the new ones.
+    old_keys = np.zeros(len(old), dtype=np.int64)
+    new_keys = np.zeros(len(new), dtype=np.int64)
+    is_unknown = np.zeros(len(new), dtype=bool)
+    radix = 1
+
+    for categories, old_codes, column in zip(
+        old.categories, old.codes, new.columns[:dimension]
+    ):
+        values = new[column]
+        if (
+            categories is None
+            or not isinstance(values.dtype, pd.CategoricalDtype)
+            or (old_codes < 0).any()
+        ):
+            return None
+
+        size = len(categories) + 1
+        if radix > np.iinfo(np.int64).max // size:
+            return None
+
+        mapping = categories.get_indexer(values.cat.categories)
+        new_codes = values.cat.codes.to_numpy()
+        mapped_codes = np.where(new_codes >= 0, mapping[new_codes], -1)
+        is_unknown |= mapped_codes < 0
+
+        old_keys += old_codes.astype(np.int64) * radix
+        new_keys += mapped_codes.astype(np.int64) * radix
+        radix *= size
+
+    index = pd.Index(old_keys)
+    if not index.is_unique:
+        return None
+
+    positions = index.get_indexer(new_keys)
+    positions[is_unknown] = -1
+
+    return positions
+
+
+def _get_records_delta(
+    old: _RecordsSnapshot | None, new: pd.DataFrame | None, dimension: int
+) -> pd.DataFrame | None:
+    """
+    Finds the records of new that were added or changed compared to old.
+
+    Parameters
+    ----------
+    old : _RecordsSnapshot | None
+        Snapshot of the records that GAMS already has
+    new : pd.DataFrame | None
+        Current records
+    dimension : int
+        Dimension of the symbol
+
+    Returns
+    -------
+    pd.DataFrame | None
+        Added and changed records. None if some records were removed or if
+        the delta is not considerably smaller than the records.
+    """
+    if (
+        old is None
+        or new is None
+        or len(new) < len(old)
+        or old.columns != list(new.columns)
+    ):
+        return None
+
+    bits = _get_value_bits(new, dimension)
+
+    is_aligned = all(
+        categories is not None
+        and isinstance(new[column].dtype, pd.CategoricalDtype)
+        and categories.equals(new[column].cat.categories)
+        and np.array_equal(
+            codes, new[column].cat.codes.to_numpy()[: len(old)]
+        )
+        for categories, codes, column in zip(
+            old.categories, old.codes, new.columns[:dimension]
+        )
+    )
+
+    if is_aligned:
+        # Records were only updated in place or appended at the end
+        is_delta = np.concatenate(
+            [
+                (old.bits != bits[: len(old)]).any(axis=1),
+                np.ones(len(new) - len(old), dtype=bool),
+            ]
+        )
+    else:
+        positions = _match_records(old, new, dimension)
+        if positions is None:
+            return None
+
+        is_matched = positions >= 0
+        if len(np.unique(positions[is_matched])) != len(old):
+            # Some records were removed
+            return None
+
+        is_delta = ~is_matched
+        is_delta[is_matched] = (
+            old.bits[positions[is_matched]] != bits[is_matched]
+        ).any(axis=1)
+
+    if is_delta.sum() * 2 > len(new):
+        return None
+
+    return new[is_delta]
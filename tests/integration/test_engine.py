@@ -236,6 +236,30 @@ class EngineSuite(unittest.TestCase):
         os.unlink(file.name)
         os.unlink(same_directory_file.name)
 
+    def test_filter_results(self):
+        from gamspy._backend.engine import GAMSEngine
+
+        m = Container()
+        engine_config = EngineConfig(
+            host="http://localhost", filter_results=True
+        )
+        engine = GAMSEngine(m, engine_config, m.workspace.add_options())
+
+        engine_options = engine._get_engine_options()
+        self.assertIn(engine.gdx_out, engine_options["inex_string"])
+
+        # Only the requested symbols are unloaded to the result gdx
+        self.assertEqual(engine.get_unload_names(["x", "e"]), ["x", "e"])
+        engine.load_symbols = ["x"]
+        self.assertEqual(engine.get_unload_names(["x", "e"]), ["x"])
+
+        engine_config.filter_results = False
+        self.assertEqual(engine.get_unload_names(["x", "e"]), ["x", "e"])
+
+        engine_config.engine_options = {"inex_string": "{}"}
+        engine_config.filter_results = True
+        self.assertRaises(ValidationError, engine._get_engine_options)
+
     def test_solve_twice(self):
         m = Container(delayed_execution=os.getenv("DELAYED_EXECUTION", False))
 
@@ -3,6 +3,8 @@ from __future__ import annotations
 import os
 import unittest
 
+import pandas as pd
+
 from gamspy import Container
 from gamspy import Equation
 from gamspy import Model
@@ -11,6 +13,7 @@ from gamspy import Sense
 from gamspy import Set
 from gamspy import Sum
 from gamspy import Variable
+from gamspy.exceptions import ValidationError
 
 
 class ModelInstanceSuite(unittest.TestCase):
@@ -90,8 +93,62 @@ class ModelInstanceSuite(unittest.TestCase):
             transport.solve(model_instance_options={"solver": "conopt"})
             self.assertAlmostEqual(z.records["level"][0], result, places=2)
 
+        # Only the modifiables are written to the model instance
+        written_names = []
+        write = m.write
+
+        def write_and_record(write_to, symbol_names=None, *args, **kwargs):
+            written_names.append(symbol_names)
+            return write(write_to, symbol_names, *args, **kwargs)
+
+        m.write = write_and_record
+        transport.solve(model_instance_options={"solver": "conopt"})
+        m.write = write
+        self.assertEqual(written_names, [["bmult"]])
+
+        # The results must be sent to GAMS in the next run
+        self.assertTrue(x.modified)
+        self.assertTrue(z.modified)
+
+        # Solve all scenarios in one call
+        scenarios = pd.DataFrame(
+            [[f"s{idx}", value] for idx, value in enumerate(bmult_list)],
+            columns=["scenario", "value"],
+        )
+        summary, records = transport.solve_scenarios(
+            {bmult: scenarios}, model_instance_options={"solver": "conopt"}
+        )
+
+        self.assertEqual(
+            summary["scenario"].tolist(), scenarios["scenario"].tolist()
+        )
+        for objective, result in zip(summary["Objective"], results):
+            self.assertAlmostEqual(objective, result, places=2)
+
+        self.assertEqual(records["x"].columns[0], "scenario")
+        self.assertEqual(len(records["z"]), len(bmult_list))
+        self.assertAlmostEqual(
+            records["z"]["level"].tolist()[-1], results[-1], places=2
+        )
+
         transport.unfreeze()
         self.assertFalse(transport._is_frozen)
+        self.assertRaises(
+            ValidationError, transport.solve_scenarios, {bmult: scenarios}
+        )
+
+        # Every table must have records for all scenarios
+        transport.freeze(modifiables=[bmult, a])
+        capacity_scenarios = pd.DataFrame(
+            [["s0", "seattle", 350], ["s0", "san-diego", 600]],
+            columns=["scenario", "i", "value"],
+        )
+        self.assertRaises(
+            ValidationError,
+            transport.solve_scenarios,
+            {bmult: scenarios, a: capacity_scenarios},
+        )
+        transport.unfreeze()
 
     def test_variable_change(self):
         m = Container(
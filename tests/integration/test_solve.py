@@ -2,6 +2,7 @@
 # fmt: off
 from __future__ import annotations
 
+import io
 import os
 import time
 import unittest
@@ -1180,6 +1181,679 @@ class SolveSuite(unittest.TestCase):
         f[...] = 5
         self.assertEqual(m._unsaved_statements[-1].getStatement(), "f = 5;")
     
+    def test_session_backend(self):
+        m = Container(backend="session")
+        i = Set(m, name="i", records=["seattle", "san-diego"])
+        a = Parameter(m, name="a", domain=[i], records=[["seattle", 350]])
+        b = Parameter(m, name="b", domain=[i])
+
+        for value in range(1, 4):
+            b[i] = a[i] * value
+            self.assertEqual(b.records.value.tolist(), [350 * value])
+
+        x = Variable(m, name="x", domain=[i], type="Positive")
+        e = Equation(m, name="e", domain=[i])
+        e[i] = x[i] >= a[i]
+
+        model = Model(
+            m,
+            name="session_model",
+            equations=[e],
+            problem="LP",
+            sense=Sense.MIN,
+            objective=Sum(i, x[i]),
+        )
+        summary = model.solve(backend="session")
+        self.assertEqual(summary["Solver Status"].tolist()[0], "Normal")
+        self.assertEqual(model.objective_value, 350)
+
+        with self.assertRaises(GamspyException):
+            m._addGamsCode("undefined_symbol = 5;")
+            m._run()
+
+        # Parameter and log files of the runs are removed
+        self.assertFalse(
+            any(
+                name.startswith("_job_") and name.endswith((".pf", ".log"))
+                for name in os.listdir(m.working_directory)
+            )
+        )
+
+    def test_load_symbols(self):
+        m = Container()
+        i = Set(m, name="i", records=["seattle", "san-diego"])
+        a = Parameter(m, name="a", domain=[i], records=[["seattle", 350]])
+
+        x = Variable(m, name="x", domain=[i], type="Positive")
+        e = Equation(m, name="e", domain=[i])
+        e[i] = x[i] >= a[i]
+
+        model = Model(
+            m,
+            name="lazy_model",
+            equations=[e],
+            problem="LP",
+            sense=Sense.MIN,
+            objective=Sum(i, x[i]),
+        )
+        model.solve(load_symbols=[x])
+        self.assertNotIn("x", m._deferred_symbols)
+        self.assertIn("e", m._deferred_symbols)
+        self.assertEqual(x.records.level.tolist()[0], 350)
+
+        # Deferred records must survive the next run
+        a["san-diego"] = 100
+        self.assertIn("e", m._deferred_symbols)
+        self.assertEqual(e.records.level.tolist()[0], 350)
+        self.assertNotIn("e", m._deferred_symbols)
+
+        def preserved_files():
+            return [
+                name
+                for name in os.listdir(m.working_directory)
+                if name.startswith("_gdx_deferred_")
+            ]
+
+        # Deferred symbols are written in full after they are replaced
+        model.solve(load_symbols=[x])
+        self.assertIsNone(e._synced_records)
+
+        # Preserved files are removed once no deferred symbol needs them
+        a["seattle"] = 200
+        self.assertEqual(len(preserved_files()), 1)
+        e.records = None
+        self.assertEqual(preserved_files(), [])
+
+        model.solve(load_symbols=[x])
+        a["seattle"] = 300
+        model.solve(load_symbols=[x])
+        a["seattle"] = 350
+        self.assertEqual(len(preserved_files()), 1)
+
+    def test_solve_batch(self):
+        i = Set(self.m, name="i", records=["seattle", "san-diego"])
+        j = Set(self.m, name="j", records=["new-york", "chicago", "topeka"])
+
+        a = Parameter(
+            self.m,
+            name="a",
+            domain=[i],
+            records=[["seattle", 350], ["san-diego", 600]],
+        )
+        b = Parameter(
+            self.m,
+            name="b",
+            domain=[j],
+            records=[["new-york", 325], ["chicago", 300], ["topeka", 275]],
+        )
+        c = Parameter(self.m, name="c", domain=[i, j])
+        c[i, j] = 0.1
+
+        x = Variable(self.m, name="x", domain=[i, j], type="Positive")
+        supply = Equation(self.m, name="supply", domain=[i])
+        demand = Equation(self.m, name="demand", domain=[j])
+        supply[i] = Sum(j, x[i, j]) <= a[i]
+        demand[j] = Sum(i, x[i, j]) >= b[j]
+
+        transport = Model(
+            self.m,
+            name="transport",
+            equations=[supply, demand],
+            problem="LP",
+            sense=Sense.MIN,
+            objective=Sum((i, j), c[i, j] * x[i, j]),
+        )
+
+        scenarios = [
+            {b: [["new-york", value], ["chicago", 300], ["topeka", 275]]}
+            for value in [100, 200, 300]
+        ]
+        results = transport.solve_batch(scenarios, workers=2)
+
+        self.assertEqual(len(results), 3)
+        for value, result in zip([100, 200, 300], results):
+            self.assertEqual(result.status, ModelStatus.OptimalGlobal)
+            self.assertAlmostEqual(result.objective_value, (value + 575) * 0.1)
+            self.assertEqual(
+                result.summary["Model Status"].tolist()[0], "OptimalGlobal"
+            )
+            self.assertIn("x", result.records.keys())
+
+        # Records of the container must stay the same
+        self.assertEqual(b.records.value.tolist(), [325, 300, 275])
+        self.assertFalse(b.modified)
+
+        results = transport.solve_batch(scenarios[:1], load_symbols=[x])
+        self.assertEqual(list(results[0].records.keys()), ["x"])
+
+        self.assertRaises(
+            ValidationError,
+            transport.solve_batch,
+            scenarios,
+            backend="neos",
+        )
+        self.assertRaises(ValidationError, transport.solve_batch, [{x: 5}])
+
+    def test_neos_job_pool(self):
+        from unittest.mock import patch
+
+        from gamspy import NeosClient
+        from gamspy import NeosJobPool
+        from gamspy._backend.batch import Batch
+        from gamspy._backend.batch import ScenarioResult
+
+        i = Set(self.m, name="i", records=["seattle", "san-diego"])
+        a = Parameter(
+            self.m,
+            name="a",
+            domain=[i],
+            records=[["seattle", 350], ["san-diego", 600]],
+        )
+        x = Variable(self.m, name="x", domain=[i], type="Positive")
+        e = Equation(self.m, name="e", domain=[i])
+        e[i] = x[i] >= a[i]
+
+        model = Model(
+            self.m,
+            name="model",
+            equations=[e],
+            problem="LP",
+            sense=Sense.MIN,
+            objective=Sum(i, x[i]),
+        )
+
+        directories = []
+
+        def solve_in_directory(client, directory, poll_interval):
+            self.assertTrue(os.path.isfile(os.path.join(directory, "in.gdx")))
+            self.assertTrue(
+                os.path.isfile(os.path.join(directory, "neos.xml"))
+            )
+            directories.append(directory)
+
+        def postprocess_scenario(batch, job, future):
+            value = 100 if job.directory == directories[0] else 200
+            records = pd.DataFrame(
+                [["seattle", value, 0, 0, np.inf, 1]],
+                columns=["i", "level", "marginal", "lower", "upper", "scale"],
+            )
+            return ScenarioResult(
+                None, {"x": records}, ModelStatus.OptimalGlobal, 1, value
+            )
+
+        client = NeosClient(email="jane.doe@gmail.com")
+        with patch.object(
+            NeosClient, "_solve_in_directory", solve_in_directory
+        ), patch.object(Batch, "postprocess_scenario", postprocess_scenario):
+            with NeosJobPool(client, workers=2, poll_interval=0) as pool:
+                pool.submit(model, {a: [["seattle", 100]]})
+                pool.submit(model, {a: [["seattle", 200]]})
+                results = pool.wait()
+
+                self.assertEqual(len(results), 2)
+                self.assertEqual(
+                    sorted(result.objective_value for result in results),
+                    [100, 200],
+                )
+                self.assertIsNone(x.records)
+
+                # Staging directories are removed after the jobs finish
+                for directory in directories:
+                    self.assertFalse(os.path.exists(directory))
+
+                # Records are set without iterating over the jobs
+                future = pool.submit(
+                    model, {a: [["seattle", 300]]}, load_results=True
+                )
+                records = future.result().records
+                self.assertEqual(records["x"].shape, (1, 6))
+                self.assertEqual(x.records.shape, (1, 6))
+
+                pool.submit(model, {a: [["seattle", 400]]})
+                for future in pool.as_completed():
+                    self.assertEqual(future.result().objective_value, 200)
+
+        # Records of the container must stay the same
+        self.assertEqual(a.records.value.tolist(), [350, 600])
+        self.assertRaises(ValidationError, NeosJobPool, client, workers=0)
+
+    def test_compile(self):
+        i = Set(self.m, name="i", records=["seattle", "san-diego"])
+        a = Parameter(
+            self.m,
+            name="a",
+            domain=[i],
+            records=[["seattle", 350], ["san-diego", 600]],
+        )
+
+        x = Variable(self.m, name="x", domain=[i], type="Positive")
+        e = Equation(self.m, name="e", domain=[i])
+        e[i] = x[i] >= a[i]
+
+        model = Model(
+            self.m,
+            name="model",
+            equations=[e],
+            problem="LP",
+            sense=Sense.MIN,
+            objective=Sum(i, x[i]),
+        )
+        model.compile()
+        self.assertNotIn("Parameter", model._compiled_solve_string)
+
+        model.solve()
+        self.assertEqual(model.status, ModelStatus.OptimalGlobal)
+        self.assertAlmostEqual(model.objective_value, 950)
+
+        # Model attributes are not declared again
+        self.assertFalse(
+            any(
+                name.startswith(Model._generate_prefix)
+                for name in self.m.data.keys()
+            )
+        )
+
+        codes = []
+        write_gams_code = self.m._write_gams_code
+
+        def record_gams_code(file, *args):
+            buffer = io.StringIO()
+            write_gams_code(buffer, *args)
+            codes.append(buffer.getvalue())
+            file.write(buffer.getvalue())
+
+        self.m._write_gams_code = record_gams_code
+        a["seattle"] = 100
+        model.solve()
+        self.m._write_gams_code = write_gams_code
+        self.assertAlmostEqual(model.objective_value, 700)
+        self.assertEqual(x.records.level.tolist(), [100, 600])
+
+        # Only the solve of the model unloads its attributes and it does not
+        # declare them again
+        attribute_name = f"{Model._generate_prefix}model_modelStat"
+        self.assertIn(attribute_name, codes[-1])
+        self.assertNotIn("Parameter", codes[-1])
+        for code in codes[:-1]:
+            self.assertNotIn(attribute_name, code)
+
+        # Equations are still generated from their current definition
+        e[i] = x[i] >= 2 * a[i]
+        model.solve()
+        self.assertAlmostEqual(model.objective_value, 1400)
+
+    def test_solve_async(self):
+        i = Set(self.m, name="i", records=["seattle", "san-diego"])
+        a = Parameter(
+            self.m,
+            name="a",
+            domain=[i],
+            records=[["seattle", 350], ["san-diego", 600]],
+        )
+
+        x = Variable(self.m, name="x", domain=[i], type="Positive")
+        e = Equation(self.m, name="e", domain=[i])
+        e[i] = x[i] >= a[i]
+
+        model = Model(
+            self.m,
+            name="async_model",
+            equations=[e],
+            problem="LP",
+            sense=Sense.MIN,
+            objective=Sum(i, x[i]),
+        )
+
+        future = model.solve_async()
+
+        # Accessing the records waits for the solve
+        self.assertEqual(x.records.level.tolist(), [350, 600])
+        summary = future.result()
+        self.assertEqual(summary["Solver Status"].tolist()[0], "Normal")
+        self.assertEqual(model.objective_value, 950)
+        self.assertEqual(self.m._pending_symbols, set())
+
+        # Synchronous solves wait for the pending solve
+        future = model.solve_async()
+        a["san-diego"] = 500
+        model.solve()
+        self.assertTrue(future.done())
+        self.assertEqual(x.records.level.tolist(), [350, 500])
+        a["san-diego"] = 600
+
+        # Statements wait for the pending solve
+        future = model.solve_async()
+        a["seattle"] = 100
+        future.result()
+        self.assertEqual(a.records.value.tolist(), [100, 600])
+
+        # asyncio integration
+        import asyncio
+
+        async def solve():
+            return await asyncio.wrap_future(model.solve_async())
+
+        summary = asyncio.run(solve())
+        self.assertEqual(summary["Solver Status"].tolist()[0], "Normal")
+        self.assertEqual(model.objective_value, 700)
+
+        # Exceptions are raised by the future and by the next statement
+        self.m._addGamsCode("abort 'failed';")
+        future = model.solve_async()
+        with self.assertRaises(GamspyException):
+            a["seattle"] = 200
+        self.assertRaises(GamspyException, future.result)
+        self.assertTrue(x._is_dirty)
+
+        self.assertRaises(ValidationError, model.solve_async, backend="neos")
+
+    def test_timings(self):
+        phases = []
+
+        def callback(phase, duration, attributes):
+            phases.append(phase)
+            self.assertGreaterEqual(duration, 0)
+            self.assertEqual(attributes["backend"], "Local")
+
+        m = Container(timing_callback=callback)
+        i = Set(m, name="i", records=["seattle", "san-diego"])
+        a = Parameter(m, name="a", domain=[i], records=[["seattle", 350]])
+
+        x = Variable(m, name="x", domain=[i], type="Positive")
+        e = Equation(m, name="e", domain=[i])
+        e[i] = x[i] >= a[i]
+
+        model = Model(
+            m,
+            name="timed_model",
+            equations=[e],
+            problem="LP",
+            sense=Sense.MIN,
+            objective=Sum(i, x[i]),
+        )
+        summary = model.solve()
+
+        for column in [
+            "Tracking Time",
+            "Validation Time",
+            "GDX Write Time",
+            "Generation Time",
+            "GAMS Time",
+            "GDX Read Time",
+        ]:
+            self.assertGreaterEqual(summary[column].tolist()[0], 0)
+
+        self.assertGreater(summary["GAMS Time"].tolist()[0], 0)
+        self.assertGreater(summary["Bytes Read"].tolist()[0], 0)
+
+        for phase in ["validation", "gdx_write", "generation", "gams"]:
+            self.assertIn(phase, phases)
+
+        self.assertIsNotNone(m.copy("copy_directory")._timing_callback)
+
+    def test_solve_cache(self):
+        from unittest.mock import patch
+
+        from gamspy import DiskCache
+        from gamspy._backend.local import Local
+
+        cache = DiskCache(os.path.join(self.m.working_directory, "cache"))
+
+        def build(m, supply, variable_type="Positive"):
+            i = Set(m, name="i", records=["seattle", "san-diego"])
+            a = Parameter(m, name="a", domain=[i], records=supply)
+            x = Variable(m, name="x", domain=[i], type=variable_type)
+            e = Equation(m, name="e", domain=[i])
+            e[i] = x[i] >= a[i]
+
+            model = Model(
+                m,
+                name="cached",
+                equations=[e],
+                problem="LP",
+                sense=Sense.MIN,
+                objective=Sum(i, x[i]),
+            )
+            return model, a, x
+
+        supply = [["seattle", 350], ["san-diego", 600]]
+        model, a, x = build(self.m, supply)
+        summary = model.solve(cache=cache)
+        self.assertEqual(len(os.listdir(cache.directory)), 1)
+
+        # Same model and data in another container is a hit
+        m = Container(delayed_execution=True)
+        model2, a2, x2 = build(m, supply)
+        with patch.object(Local, "run") as run:
+            cached_summary = model2.solve(cache=cache)
+            run.assert_not_called()
+
+        self.assertEqual(model2.status, ModelStatus.OptimalGlobal)
+        self.assertAlmostEqual(model2.objective_value, 950)
+        self.assertEqual(x2.records.level.tolist(), [350, 600])
+        self.assertEqual(
+            summary["Model Status"].tolist(),
+            cached_summary["Model Status"].tolist(),
+        )
+
+        # Timings of a hit describe the load of the entry
+        self.assertEqual(cached_summary["GAMS Time"].tolist(), [0])
+        self.assertGreater(cached_summary["Bytes Read"].tolist()[0], 0)
+
+        # Cached results are sent to GAMS in the next run
+        self.assertTrue(x2.modified)
+        i2 = m["i"]
+        y = Parameter(m, name="y", domain=[i2])
+        y[i2] = x2.l[i2]
+        self.assertEqual(y.records.value.tolist(), [350, 600])
+
+        # Different data is a miss
+        a2["seattle"] = 100
+        model2.solve(cache=cache)
+        self.assertAlmostEqual(model2.objective_value, 700)
+        self.assertEqual(len(os.listdir(cache.directory)), 2)
+
+        # Invalidated entries are solved again
+        cache.invalidate("other")
+        self.assertEqual(len(os.listdir(cache.directory)), 2)
+        cache.invalidate("cached")
+        self.assertEqual(os.listdir(cache.directory), [])
+
+        m = Container(delayed_execution=True)
+        model3, _, _ = build(m, supply)
+        model3.solve(cache=cache)
+        self.assertAlmostEqual(model3.objective_value, 950)
+        self.assertEqual(len(os.listdir(cache.directory)), 1)
+
+        # A different variable type is a miss
+        m = Container(delayed_execution=True)
+        model4, _, _ = build(m, supply, variable_type="Free")
+        self.assertNotEqual(
+            model3._get_cache_key(None, None, None),
+            model4._get_cache_key(None, None, None),
+        )
+
+        # Symbols that the model does not reference do not change the key
+        key = model4._get_cache_key(None, None, None)
+        _ = Parameter(m, name="unrelated", records=5)
+        self.assertEqual(model4._get_cache_key(None, None, None), key)
+
+        model4.solve(cache=cache)
+        self.assertEqual(len(os.listdir(cache.directory)), 2)
+
+        # Expired entries are not returned
+        expiring_cache = DiskCache(cache.directory, max_age=1e-9)
+        time.sleep(0.01)
+        key = os.listdir(cache.directory)[0][: -len(".zip")]
+        self.assertIsNone(expiring_cache.get(key))
+        self.assertRaises(ValidationError, DiskCache, cache.directory, 0)
+
+    def test_warm_start(self):
+        i = Set(self.m, name="i", records=["i1", "i2", "i3"])
+        c = Parameter(
+            self.m,
+            name="c",
+            domain=[i],
+            records=[["i1", 3], ["i2", 2], ["i3", 4]],
+        )
+        x = Variable(self.m, name="x", domain=[i], type="integer")
+        x.up[i] = 10
+        e = Equation(self.m, name="e")
+        e[...] = Sum(i, x[i]) >= 7
+
+        model = Model(
+            self.m,
+            name="warm",
+            equations=[e],
+            problem="MIP",
+            sense=Sense.MIN,
+            objective=Sum(i, c[i] * x[i]),
+        )
+
+        # Advanced basis is always built and levels are the MIP start
+        gams_options = model._prepare_gams_options(
+            solver="CPLEX", warm_start=True
+        )
+        self.assertEqual(gams_options.bratio, 0)
+        self.assertEqual(gams_options.optfile, 123)
+        with open(
+            os.path.join(self.m.working_directory, "cplex.123")
+        ) as file:
+            self.assertIn("mipstart 1", file.read())
+
+        # Options of the user are kept
+        gams_options = model._prepare_gams_options(
+            solver="CPLEX",
+            options=Options(basis_detection_threshold=0.5),
+            solver_options={"mipstart": 0},
+            warm_start=True,
+        )
+        self.assertEqual(gams_options.bratio, 0.5)
+        with open(
+            os.path.join(self.m.working_directory, "cplex.123")
+        ) as file:
+            self.assertIn("mipstart 0", file.read())
+
+        # Solver of the problem type in the options is used
+        gams_options = model._prepare_gams_options(
+            options=Options(mip="GUROBI"), warm_start=True
+        )
+        with open(
+            os.path.join(self.m.working_directory, "gurobi.123")
+        ) as file:
+            self.assertIn("mipstart 1", file.read())
+
+        # Default solver of the problem type is used without a solver
+        import gamspy.utils as utils
+        from gamspy._options import mip_start_map
+
+        default_solver = utils._get_default_solvers()["MIP"]
+        gams_options = model._prepare_gams_options(warm_start=True)
+        if default_solver in mip_start_map:
+            self.assertEqual(gams_options.optfile, 123)
+            with open(
+                os.path.join(
+                    self.m.working_directory, f"{default_solver.lower()}.123"
+                )
+            ) as file:
+                key = next(iter(mip_start_map[default_solver]))
+                self.assertIn(f"{key} 1", file.read())
+
+        # Solvers that cannot start from the levels are reported
+        with self.assertLogs("Options", level="WARNING"):
+            gams_options = model._prepare_gams_options(
+                solver="HIGHS", warm_start=True
+            )
+        self.assertEqual(gams_options.bratio, 0)
+
+        model.solve(solver="CPLEX", warm_start=True)
+        self.assertAlmostEqual(model.objective_value, 14)
+
+        c["i2"] = 5
+        model.solve(solver="CPLEX", warm_start=True)
+        self.assertAlmostEqual(model.objective_value, 21)
+        self.assertEqual(x.records.level.tolist(), [7, 0, 0])
+
+        # Other problem types do not get solver options
+        relaxed = Model(
+            self.m,
+            name="relaxed",
+            equations=[e],
+            problem="RMIP",
+            sense=Sense.MIN,
+            objective=Sum(i, c[i] * x[i]),
+        )
+        gams_options = relaxed._prepare_gams_options(
+            solver="CPLEX", warm_start=True
+        )
+        self.assertEqual(gams_options.bratio, 0)
+        self.assertNotEqual(gams_options.optfile, 123)
+
+    def test_generate(self):
+        i = Set(self.m, name="i", records=["seattle", "san-diego"])
+        j = Set(self.m, name="j", records=["new-york", "chicago", "topeka"])
+        a = Parameter(
+            self.m,
+            name="a",
+            domain=[i],
+            records=[["seattle", 350], ["san-diego", 600]],
+        )
+        x = Variable(self.m, name="x", domain=[i, j], type="Positive")
+        z = Variable(self.m, name="z")
+
+        supply = Equation(self.m, name="supply", domain=[i])
+        supply[i] = Sum(j, x[i, j]) <= a[i]
+        cost = Equation(self.m, name="cost")
+        cost[...] = z == Sum([i, j], x[i, j] * x[i, j])
+
+        model = Model(
+            self.m,
+            name="generated",
+            equations=[supply, cost],
+            problem="QCP",
+            sense=Sense.MIN,
+            objective=z,
+        )
+        statistics = model.generate()
+
+        self.assertEqual(
+            statistics.columns.tolist(),
+            ["Equation", "Rows", "Generation Time", "Memory"],
+        )
+        rows = dict(zip(statistics["Equation"], statistics["Rows"]))
+        self.assertEqual(rows, {"supply": 2, "cost": 1})
+        self.assertTrue(statistics["Generation Time"].is_monotonic_decreasing)
+
+        # Totals of the model are in the model attributes
+        self.assertEqual(model.num_equations, 3)
+        self.assertEqual(model.num_variables, 7)
+        self.assertEqual(model.num_nonzeros, 13)
+        self.assertEqual(model.num_nonlinear_zeros, 6)
+        self.assertGreater(model.num_nonlinear_insts, 0)
+
+        # The model is not solved
+        self.assertIsNone(x._records)
+
+        # Files of CONVERT are removed
+        self.assertFalse(
+            os.path.exists(os.path.join(self.m.working_directory, "gams.gms"))
+        )
+        self.assertFalse(
+            any(
+                os.path.isdir(os.path.join(self.m.working_directory, name))
+                for name in os.listdir(self.m.working_directory)
+                if name.startswith("tmp")
+            )
+        )
+
+        from unittest.mock import patch
+
+        with patch("gamspy._model.getInstalledSolvers", return_value=[]):
+            self.assertRaises(ValidationError, model.generate)
+
+        model.freeze(modifiables=[a])
+        self.assertRaises(ValidationError, model.generate)
+
 
 def solve_suite():
     suite = unittest.TestSuite()
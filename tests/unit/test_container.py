@@ -134,6 +134,40 @@ class ContainerSuite(unittest.TestCase):
         self.m.read("test.gdx", ["i"])
         self.assertEqual(list(self.m.data.keys()), ["k", "i"])
 
+    def test_read_adopts_symbols(self):
+        m = Container()
+        i = Set(m, "i", records=["i1", "i2", "i3"])
+        j = Alias(m, "j", i)
+        a = Parameter(m, "a", domain=[i], records=[("i1", 1), ("i3", 3)])
+        b = Parameter(m, "b", domain=[i, j], records=[("i1", "i2", 2)])
+        v = Variable(m, "v", domain=[i])
+        v.setRecords(pd.DataFrame([["i2", 5]], columns=["i", "level"]))
+        e = Equation(m, "e", type="leq", domain=[i])
+        gdx_path = os.path.join(m.working_directory, "adopt.gdx")
+        m.write(gdx_path)
+
+        new_cont = Container()
+        new_cont.read(gdx_path)
+
+        for symbol in [i, j, a, b, v, e]:
+            new_symbol = new_cont[symbol.name]
+            self.assertIsInstance(new_symbol, type(symbol))
+            if symbol.records is None:
+                self.assertIsNone(new_symbol.records)
+            else:
+                self.assertEqual(
+                    new_symbol.records.values.tolist(),
+                    symbol.records.values.tolist(),
+                )
+
+        # Symbols are adopted with their domains and declared once
+        self.assertIs(new_cont["a"].domain[0], new_cont["i"])
+        self.assertIs(new_cont["j"].alias_with, new_cont["i"])
+        self.assertEqual(len(new_cont._unsaved_statements), 6)
+
+        new_cont["a"]["i2"] = 2
+        self.assertEqual(new_cont["a"].records.value.tolist(), [1, 2, 3])
+
     def test_loadRecordsFromGdx(self):
         i = Set(self.m, name="i", records=["i1", "i2"])
         a = Parameter(
@@ -166,6 +200,21 @@ class ContainerSuite(unittest.TestCase):
         self.assertEqual(i.records.values.tolist(), [["i1", ""], ["i2", ""]])
         self.assertIsNone(a.records)
 
+        # Load existing and unknown symbols together
+        new_container3 = Container(
+            delayed_execution=int(os.getenv("DELAYED_EXECUTION", False))
+        )
+        i = Set(new_container3, name="i")
+        new_container3.loadRecordsFromGdx("test.gdx", ["i", "a"])
+
+        self.assertEqual(i.records.values.tolist(), [["i1", ""], ["i2", ""]])
+        self.assertIsInstance(new_container3["a"], Parameter)
+        self.assertEqual(
+            new_container3["a"].records.values.tolist(),
+            [["i1", 1.0], ["i2", 2.0]],
+        )
+        self.assertEqual(len(new_container3._load_container.data), 0)
+
     def test_enums(self):
         self.assertEqual(str(Problem.LP), "LP")
         self.assertEqual(str(Sense.MAX), "MAX")
@@ -212,6 +261,13 @@ class ContainerSuite(unittest.TestCase):
         with self.assertRaises(ValidationError):
             m._addGamsCode("scalar pi / pi /;", import_symbols=[pi])
 
+    def test_backend(self):
+        with self.assertRaises(ValidationError):
+            _ = Container(backend="engine")
+
+        m = Container(backend="session")
+        self.assertEqual(m._backend, "session")
+
     def test_system_directory(self):
         import gamspy_base
 
@@ -329,6 +385,68 @@ class ContainerSuite(unittest.TestCase):
         self.assertIsNotNone(new_cont.gamsJobName())
         self.assertAlmostEqual(transport.objective_value, 153.675, 3)
 
+    def test_copy_shares_files(self):
+        m = Container()
+        i = Set(m, "i", records=["i1", "i2"])
+        p = Parameter(m, "p", domain=[i], records=[("i1", 1)])
+
+        new_cont = m.copy(working_directory="shared_copy")
+
+        restart_file = m._restart_from._checkpoint_file_name
+        new_restart_file = new_cont._restart_from._checkpoint_file_name
+        self.assertTrue(os.path.samefile(restart_file, new_restart_file))
+        self.assertTrue(os.path.samefile(m._gdx_out, new_cont._gdx_out))
+
+        with open(m._gdx_out, "rb") as file:
+            gdx_content = file.read()
+
+        # Running the copy must not change the files of the original
+        new_cont["p"]["i2"] = 2
+        self.assertFalse(os.path.samefile(m._gdx_out, new_cont._gdx_out))
+        with open(m._gdx_out, "rb") as file:
+            self.assertEqual(file.read(), gdx_content)
+
+        p["i2"] = 3
+        self.assertEqual(p.records.value.tolist(), [1, 3])
+        self.assertEqual(new_cont["p"].records.value.tolist(), [1, 2])
+
+    def test_shared_labels(self):
+        m = Container()
+        labels = [f"r{idx}" for idx in range(100)]
+        i = Set(m, "i", records=labels)
+        a = Parameter(
+            m, "a", domain=[i], records=[(label, 1) for label in labels]
+        )
+        b = Parameter(
+            m, "b", domain=[i], records=[(label, 2) for label in labels]
+        )
+
+        gdx_path = os.path.join(m.working_directory, "shared_labels.gdx")
+        m.write(gdx_path)
+
+        new_cont = Container()
+        new_cont.read(gdx_path)
+        self.assertIs(
+            new_cont["a"].records["i"].dtype,
+            new_cont["b"].records["i"].dtype,
+        )
+        self.assertEqual(new_cont["b"].records.values.tolist()[0], ["r0", 2])
+
+        # Loading the records of existing symbols reuses the store as well
+        new_cont.loadRecordsFromGdx(gdx_path, ["a"])
+        self.assertIs(
+            new_cont["a"].records["i"].dtype,
+            new_cont["b"].records["i"].dtype,
+        )
+
+        new_cont = m.copy(working_directory="shared_labels_copy")
+        self.assertIs(
+            new_cont["a"].records["i"].dtype,
+            new_cont["b"].records["i"].dtype,
+        )
+        self.assertEqual(a.records.value.tolist(), [1] * 100)
+        self.assertEqual(b.records.value.tolist(), [2] * 100)
+
     def test_generate_gams_string(self):
         m = Container(
             delayed_execution=int(os.getenv("DELAYED_EXECUTION", False))
@@ -353,6 +471,85 @@ class ContainerSuite(unittest.TestCase):
             f"execute_unload '{m._gdx_out}' \n",
         )
 
+    def test_streamed_gams_code(self):
+        m = Container(delayed_execution=True)
+        i = Set(m, "i", records=["i1", "i2"])
+        p = Parameter(m, "p", domain=[i])
+        p[i] = 1
+
+        m._run()
+
+        # The job runs the code that was streamed into its input file
+        path = os.path.join(m.working_directory, m.gamsJobName() + ".gms")
+        with open(path) as file:
+            gams_code = file.read()
+
+        self.assertIn("Parameter p(i);\n", gams_code)
+        self.assertIn("p(i) = 1;\n", gams_code)
+        self.assertTrue(
+            gams_code.endswith(f"execute_unload '{m._gdx_out}' p\n")
+        )
+
+        self.assertEqual(p.records.value.tolist(), [1, 1])
+
+    def test_touched_symbols(self):
+        m = Container(delayed_execution=True)
+        i = Set(m, "i", records=["i1", "i2"])
+        a = Parameter(m, "a", domain=[i], records=[["i1", 1]])
+        b = Parameter(m, "b", domain=[i])
+
+        dirty_names, modified_names = m._get_touched_symbol_names()
+        self.assertEqual(dirty_names, [])
+        self.assertEqual(modified_names, ["i", "a", "b"])
+
+        m._run()
+        self.assertEqual(m._get_touched_symbol_names(), ([], []))
+
+        b[i] = a[i] * 2
+        a.setRecords([["i2", 5]])
+        self.assertEqual(m._get_touched_symbol_names(), (["b"], ["a"]))
+
+        m.removeSymbols(["a"])
+        self.assertEqual(m._get_touched_symbol_names(), (["b"], []))
+
+        # Aliases share the records of their sets, so changing the records
+        # through an alias only requires loading the set
+        j = Alias(m, "j", i)
+        m._run()
+        j.setRecords(["i1", "i2", "i3"])
+        self.assertEqual(m._get_touched_symbol_names(), ([], ["i"]))
+        self.assertNotIn("$load j\n", m.generateGamsString())
+
+    def test_delta_transfer(self):
+        m = Container()
+        n = utils.DELTA_TRANSFER_THRESHOLD * 2
+        i = Set(m, "i", records=[f"i{idx}" for idx in range(n)])
+        p = Parameter(
+            m, "p", domain=[i], records=[[f"i{idx}", 1] for idx in range(n)]
+        )
+        s = Parameter(m, "s")
+        s[...] = Sum(i, p[i])
+        self.assertEqual(s.toValue(), n)
+
+        def last_job_source():
+            path = os.path.join(m.working_directory, m.gamsJobName() + ".gms")
+            with open(path) as file:
+                return file.read()
+
+        # Changed records are merged into the existing records
+        records = p.records.copy()
+        records.loc[0, "value"] = 5
+        p.setRecords(records)
+        s[...] = Sum(i, p[i])
+        self.assertIn("$loadM p\n", last_job_source())
+        self.assertEqual(s.toValue(), n + 4)
+
+        # Removed records require a full transfer
+        p.setRecords(records.iloc[1:])
+        s[...] = Sum(i, p[i])
+        self.assertIn("$load p\n", last_job_source())
+        self.assertEqual(s.toValue(), n - 1)
+
     def test_removal_of_autogenerated_symbols(self):
         m = Container(
             delayed_execution=int(os.getenv("DELAYED_EXECUTION", False))
@@ -449,6 +646,186 @@ class ContainerSuite(unittest.TestCase):
         m.read("test.gdx", load_records=False)
         self.assertIsNone(m["a"].records, None)
 
+    def test_incremental_validation(self):
+        from unittest import mock
+
+        m = Container()
+        i = Set(m, "i", records=["i1", "i2"])
+        a = Parameter(m, "a", domain=[i], records=[("i1", 1)])
+        b = Parameter(m, "b", domain=[i])
+
+        validated = []
+        is_valid = Parameter.isValid
+
+        def record_validation(symbol, *args, **kwargs):
+            validated.append(symbol.name)
+            return is_valid(symbol, *args, **kwargs)
+
+        # Only the modified symbols are validated
+        with mock.patch.object(Parameter, "isValid", record_validation):
+            a.setRecords([("i1", 2)])
+            b[i] = a[i]
+
+        self.assertIn("a", validated)
+        self.assertNotIn("b", validated)
+        self.assertEqual(b.records.value.tolist(), [2])
+
+        # Strict mode validates the whole container
+        m = Container(strict_validation=True)
+        i = Set(m, "i", records=["i1", "i2"])
+        with mock.patch.object(
+            Container, "isValid", return_value=True
+        ) as container_is_valid:
+            i.setRecords(["i1"])
+            _ = Parameter(m, "c", domain=[i], records=[("i1", 1)])
+
+        container_is_valid.assert_called()
+        self.assertTrue(m.copy("strict_copy")._strict_validation)
+
+    def test_add_symbols(self):
+        from gamspy._container import _DeclarationBlock
+
+        m = Container(delayed_execution=True)
+        j = Set(m, "j", records=["j1", "j2"])
+        specs = [
+            {"symbol_type": "set", "name": "i", "records": ["i1", "i2"]},
+            {"symbol_type": "Set", "name": "s", "is_singleton": True},
+            {
+                "symbol_type": "parameter",
+                "name": "a",
+                "domain": [j],
+                "records": [["j1", 1], ["j2", 2]],
+                "description": "supply",
+            },
+            {"symbol_type": "parameter", "name": "b", "domain": [j]},
+            {
+                "symbol_type": "variable",
+                "name": "x",
+                "type": "positive",
+                "domain": [j],
+            },
+            {"symbol_type": "variable", "name": "y", "type": "positive"},
+            {"symbol_type": "equation", "name": "e", "domain": [j]},
+        ]
+        i, s, a, b, x, y, e = m.addSymbols(specs)
+
+        self.assertIsInstance(i, Set)
+        self.assertTrue(s.is_singleton)
+        self.assertIsInstance(x, Variable)
+        self.assertEqual(a.description, "supply")
+
+        # All declarations are in a single block
+        blocks = [
+            statement
+            for statement in m._unsaved_statements
+            if isinstance(statement, _DeclarationBlock)
+        ]
+        self.assertEqual(len(blocks), 1)
+        self.assertEqual(blocks[0].symbols, [i, s, a, b, x, y, e])
+        self.assertEqual(
+            blocks[0].getStatement(),
+            "\n".join(
+                [
+                    "Set i;",
+                    "Singleton Set s;",
+                    'Parameter a(j) "supply",',
+                    "    b(j);",
+                    "positive Variable x(j),",
+                    "    y;",
+                    "Equation e(j);",
+                ]
+            ),
+        )
+
+        # Declarations are sent to GAMS with the records
+        b[j] = a[j] * 2
+        self.assertEqual(b.toList(), [("j1", 2.0), ("j2", 4.0)])
+        self.assertEqual(i.toList(), ["i1", "i2"])
+
+        # Symbols that are declared after a definition get a new block
+        f, z = m.addSymbols(
+            [
+                {
+                    "symbol_type": "equation",
+                    "name": "f",
+                    "domain": [j],
+                    "definition": x[j] >= a[j],
+                },
+                {"symbol_type": "variable", "name": "z"},
+            ]
+        )
+        blocks = [
+            statement
+            for statement in m._unsaved_statements
+            if isinstance(statement, _DeclarationBlock)
+        ]
+        self.assertEqual([block.symbols for block in blocks], [[f], [z]])
+        self.assertLess(
+            m._unsaved_statements.index(blocks[0]),
+            m._unsaved_statements.index(blocks[1]),
+        )
+        m._run()
+        self.assertEqual(m._unsaved_statements, [])
+
+        # Nothing is created if a spec is not valid
+        invalid_specs = [
+            [{"symbol_type": "alias", "name": "k"}],
+            [
+                {"symbol_type": "set", "name": "k"},
+                {"symbol_type": "set", "name": "k"},
+            ],
+            [
+                {"symbol_type": "set", "name": "k"},
+                {"symbol_type": "parameter", "name": "sum"},
+            ],
+            [
+                {"symbol_type": "set", "name": "k"},
+                {
+                    "symbol_type": "parameter",
+                    "name": "p",
+                    "domain": [Set(Container(), "other")],
+                },
+            ],
+        ]
+        for invalid in invalid_specs:
+            self.assertRaises(ValidationError, m.addSymbols, invalid)
+            self.assertNotIn("k", m.data)
+
+        # Errors of the constructors remove the symbols created before
+        self.assertRaises(
+            ValueError,
+            m.addSymbols,
+            [
+                {"symbol_type": "set", "name": "k"},
+                {"symbol_type": "variable", "name": "v", "type": "bla"},
+            ],
+        )
+        self.assertNotIn("k", m.data)
+        self.assertEqual(m._unsaved_statements, [])
+
+        self.assertRaises(
+            TypeError, m.addSymbols, [{"symbol_type": "set", "name": "a"}]
+        )
+        self.assertRaises(
+            TypeError, m.addSymbols, [{"symbol_type": "set", "name": 5}]
+        )
+
+        # Names are validated once for all symbols
+        from unittest.mock import patch
+
+        import gamspy._validation as validation
+
+        with patch.object(
+            validation, "validate_name", wraps=validation.validate_name
+        ) as validate_name:
+            m.addSymbols([{"symbol_type": "set", "name": "k"}])
+            validate_name.assert_not_called()
+
+            _ = Set(m, "l")
+            validate_name.assert_called_once_with("l")
+
+        self.assertRaises(ValidationError, Set, m, "sum")
+
 
 def container_suite():
     suite = unittest.TestSuite()
@@ -546,6 +546,25 @@ class EquationSuite(unittest.TestCase):
             " power(y(i),2) ))) =e= 1;",
         )
 
+    def test_long_expression(self):
+        m = Container(delayed_execution=True)
+        i = Set(m, "i", records=["i1", "i2"])
+        x = Variable(m, "x", domain=[i])
+        e = Equation(m, "e", domain=[i])
+
+        parameters = [Parameter(m, f"a{idx}", domain=[i]) for idx in range(3)]
+        expression = parameters[0][i] * x[i]
+        for idx in range(5000):
+            expression = expression + parameters[idx % 3][i] * x[i]
+
+        e[i] = expression >= 1
+        statement = e._definition.getStatement()
+
+        self.assertTrue(statement.startswith("e(i) .. "))
+        self.assertTrue(statement.endswith("=g= 1;"))
+        self.assertEqual(statement.count("* x(i)"), 5001)
+        self.assertIs(e._definition.gamsRepr(), statement)
+
     def test_assignment_dimensionality(self):
         j1 = Set(self.m, "j1")
         j2 = Set(self.m, "j2")
@@ -2,6 +2,7 @@ from __future__ import annotations
 
 import os
 import unittest
+from unittest.mock import patch
 
 import pandas as pd
 
@@ -187,6 +188,43 @@ class OperationSuite(unittest.TestCase):
             "bla(s) = (sum(c,(a(c,s) * p(c))) ne 0);",
         )
 
+    def test_representation_caching(self):
+        m = Container(delayed_execution=True)
+        i = Set(m, "i")
+        j = Set(m, "j")
+        c = Parameter(m, "c", domain=[i, j])
+        x = Variable(m, "x", domain=[i, j])
+
+        shipped = Sum(j, c[i, j] * x[i, j])
+        e1 = Equation(m, "e1", domain=i)
+        e2 = Equation(m, "e2", domain=i)
+
+        with patch.object(
+            Sum, "_get_output_tasks", wraps=shipped._get_output_tasks
+        ) as output_tasks:
+            e1[i] = shipped <= 5
+            e2[i] = shipped + x[i, "j1"] >= 1
+
+            self.assertEqual(
+                e1._definition.getStatement(),
+                "e1(i) .. sum(j,(c(i,j) * x(i,j))) =l= 5;",
+            )
+            self.assertEqual(
+                e2._definition.getStatement(),
+                'e2(i) .. (sum(j,(c(i,j) * x(i,j))) + x(i,"j1")) =g= 1;',
+            )
+
+            # The shared sum is rendered only once
+            self.assertEqual(output_tasks.call_count, 1)
+
+        # Comparisons inside operations keep their own replacements
+        p = Parameter(m, "p", domain=i)
+        p[i] = Sum(j, (c[i, j] + 1) == 2)
+        self.assertEqual(
+            m._unsaved_statements[-1].getStatement(),
+            "p(i) = sum(j,((c(i,j) + 1) eq 2));",
+        )
+
 
 def operation_suite():
     suite = unittest.TestSuite()
@@ -1,18 +1,25 @@
 from __future__ import annotations
 
+import glob
 import os
 import unittest
+from unittest.mock import patch
 
 import numpy as np
 import pandas as pd
 
+import gamspy.math as gams_math
+
 from gamspy import Alias
+from gamspy import Card
 from gamspy import Container
 from gamspy import Ord
 from gamspy import Parameter
 from gamspy import Set
+from gamspy import Smax
 from gamspy import Sum
 from gamspy import Variable
+from gamspy.exceptions import GamspyException
 from gamspy.exceptions import ValidationError
 
 
@@ -242,6 +249,179 @@ class ParameterSuite(unittest.TestCase):
         with self.assertRaises(ValidationError):
             a1["i3"] = a1["i3"] * 5
 
+    def test_bulk_construction(self):
+        m = Container()
+        i = Set(m, "i", records=["i1", "i2", "i3"])
+        j = Set(m, "j", records=["j1", "j2"])
+
+        a = Parameter.fromCoo(
+            m, "a", [i, j], [np.array([0, 2]), np.array([1, 0])], [1.5, 2]
+        )
+        self.assertEqual(
+            a.records.values.tolist(), [["i1", "j2", 1.5], ["i3", "j1", 2.0]]
+        )
+
+        b = Parameter.fromDense(m, "b", [i, j], np.arange(6).reshape(3, 2))
+        self.assertEqual(len(b.records), 5)
+        self.assertEqual(b.records.values.tolist()[0], ["i1", "j2", 1.0])
+
+        # The records are used by GAMS like any other records
+        c = Parameter(m, "c", domain=[i, j])
+        c[i, j] = a[i, j] + b[i, j]
+        self.assertEqual(
+            c.toList(),
+            [
+                ("i1", "j2", 2.5),
+                ("i2", "j1", 2.0),
+                ("i2", "j2", 3.0),
+                ("i3", "j1", 6.0),
+                ("i3", "j2", 5.0),
+            ],
+        )
+
+        # Positions outside of the domain
+        with self.assertRaises(ValidationError):
+            _ = Parameter.fromCoo(m, "d", [i, j], [[3], [0]], [1])
+
+        # Number of index arrays does not match the dimension
+        with self.assertRaises(ValidationError):
+            _ = Parameter.fromCoo(m, "d", [i, j], [[0]], [1])
+
+        # Shape does not match the domain
+        with self.assertRaises(ValidationError):
+            _ = Parameter.fromDense(m, "d", [i, j], np.ones((2, 2)))
+
+        # Universe domain has no positions
+        with self.assertRaises(ValidationError):
+            _ = Parameter.fromCoo(m, "d", ["*"], [[0]], [1])
+
+        # Invalid inputs do not declare the parameter
+        self.assertNotIn("d", m.data.keys())
+
+        # Negative zeros are kept as EPS records
+        e = Parameter.fromDense(m, "e", [i], [-0.0, 0.0, 1.0])
+        self.assertEqual(len(e.records), 2)
+        self.assertTrue(np.signbit(e.records["value"].iloc[0]))
+
+    def test_local_evaluation(self):
+        m = Container(local_evaluation=True)
+        i = Set(m, "i", records=["i1", "i2", "i3"])
+        j = Set(m, "j", records=["j1", "j2"])
+        ip = Alias(m, "ip", i)
+        a = Parameter(
+            m, "a", domain=[i], records=[("i1", 1), ("i2", 2), ("i3", 3)]
+        )
+        c = Parameter(
+            m,
+            "c",
+            domain=[i, j],
+            records=[("i1", "j1", 1), ("i2", "j2", 4), ("i3", "j1", -2)],
+        )
+        p = Parameter(m, "p", domain=[i])
+        s = Parameter(m, "s")
+        e = Set(m, "e", domain=[i])
+
+        with patch.object(m, "_run", side_effect=AssertionError("GAMS run")):
+            p[i] = a[i] * 2 + Sum(j, c[i, j])
+            self.assertEqual(
+                p.toList(), [("i1", 3.0), ("i2", 8.0), ("i3", 4.0)]
+            )
+
+            p[i] = p[i].where[a[i] > 1]
+            self.assertEqual(p.toList(), [("i2", 8.0), ("i3", 4.0)])
+
+            s[...] = Smax(ip, a[ip]) + Card(j)
+            self.assertEqual(s.toValue(), 5)
+
+            # Rendered expressions are still evaluated locally
+            expr = a[i] + 1
+            _ = expr.gamsRepr()
+            p[i] = expr
+            self.assertEqual(
+                p.toList(), [("i1", 2.0), ("i2", 3.0), ("i3", 4.0)]
+            )
+
+            s[...] = Sum(e, a[e])
+            self.assertEqual(s.toValue(), 0)
+
+        # Reductions over empty sets yielding infinity are left to GAMS
+        s[...] = Smax(e, a[e])
+        self.assertEqual(s.toValue(), float("-inf"))
+
+        # Functions are evaluated by GAMS with the local results
+        q = Parameter(m, "q", domain=[i])
+        q[i] = gams_math.sqrt(p[i])
+        self.assertEqual(q.toList()[1], ("i3", 2.0))
+        self.assertFalse(m._unsaved_statements)
+
+        # Division by zero is reported by GAMS
+        with self.assertRaises(GamspyException):
+            q[i] = a[i] / (a[i] - 1)
+
+        # Indices outside of the domain are reported by GAMS
+        b = Parameter(m, "b", domain=[j], records=[("j1", 1)])
+        with self.assertRaises(GamspyException):
+            s[...] = Sum(i, b[i])
+
+    def test_records_from_file(self):
+        m = Container(delayed_execution=os.getenv("DELAYED_EXECUTION", False))
+        i = Set(m, "i", records=[f"i{idx}" for idx in range(5)])
+        df = pd.DataFrame(
+            [(f"i{idx}", idx + 1.0) for idx in range(5)],
+            columns=["i", "value"],
+        )
+
+        for extension in ["parquet", "arrow"]:
+            path = os.path.join(m.working_directory, f"a.{extension}")
+            if extension == "parquet":
+                df.to_parquet(path)
+            else:
+                df.to_feather(path)
+
+            a = Parameter.fromFile(
+                m, f"a_{extension}", [i], path, chunk_size=2
+            )
+            self.assertIsNone(a._records)
+
+            # All chunks are loaded on the GAMS side
+            b = Parameter(m, f"b_{extension}", domain=[i])
+            b[i] = a[i] * 2
+            self.assertEqual(
+                b.toList(), [(f"i{idx}", 2 * (idx + 1.0)) for idx in range(5)]
+            )
+            self.assertIsNone(a._records)
+
+            # The chunk files are removed after the run
+            self.assertFalse(
+                glob.glob(os.path.join(m.working_directory, "*_chunk_*"))
+            )
+
+            # Records are read into memory on access
+            self.assertEqual(a.toList(), list(df.itertuples(index=False)))
+            self.assertIsNone(a._records_file)
+
+        # Wrong number of columns
+        path = os.path.join(m.working_directory, "wrong.parquet")
+        df.assign(extra=1).to_parquet(path)
+        self.assertRaises(
+            ValidationError, Parameter.fromFile, m, "c", [i], path
+        )
+
+        # Chunk size must be positive
+        self.assertRaises(
+            ValidationError,
+            Parameter.fromFile,
+            m,
+            "d",
+            [i],
+            os.path.join(m.working_directory, "a.parquet"),
+            chunk_size=0,
+        )
+
+        # Invalid files do not declare the parameters
+        self.assertNotIn("c", m.data.keys())
+        self.assertNotIn("d", m.data.keys())
+
 
 def parameter_suite():
     suite = unittest.TestSuite()
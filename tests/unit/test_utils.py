@@ -44,6 +44,74 @@ class UtilsSuite(unittest.TestCase):
             Exception, utils._open_gdx_file, self.m.system_directory, "bla.gdx"
         )
 
+    def test_records_delta(self):
+        import pandas as pd
+
+        old = pd.DataFrame(
+            {"i": pd.Categorical(["a", "b", "c"]), "value": [1.0, 2.0, 3.0]}
+        )
+
+        snapshot = utils._RecordsSnapshot(old, dimension=1)
+        self.assertEqual(len(snapshot), 3)
+
+        # Only updated
+        new = old.copy()
+        new.loc[1, "value"] = 0.0
+        delta = utils._get_records_delta(snapshot, new, dimension=1)
+        self.assertEqual(delta["i"].tolist(), ["b"])
+
+        # Zero and EPS are different values
+        eps = new.copy()
+        eps.loc[1, "value"] = -0.0
+        delta = utils._get_records_delta(
+            utils._RecordsSnapshot(new, dimension=1), eps, dimension=1
+        )
+        self.assertEqual(delta["i"].tolist(), ["b"])
+
+        # Nothing changed
+        delta = utils._get_records_delta(snapshot, old.copy(), dimension=1)
+        self.assertEqual(len(delta), 0)
+
+        # Removed records
+        self.assertIsNone(utils._get_records_delta(snapshot, old[1:], 1))
+
+        # Reordered and appended with different categories
+        new = pd.DataFrame(
+            {
+                "i": pd.Categorical(["c", "b", "a", "d", "e", "f", "g"]),
+                "value": [3.0, 2.0, 1.0, 4.0, 5.0, 6.0, 7.0],
+            }
+        )
+        self.assertIsNone(utils._get_records_delta(snapshot, new, 1))
+
+        new = new[:4]
+        delta = utils._get_records_delta(snapshot, new, dimension=1)
+        self.assertEqual(delta["i"].tolist(), ["d"])
+
+        # Matched on the labels of every domain column
+        old = pd.DataFrame(
+            {
+                "i": pd.Categorical(["a", "a", "b"]),
+                "j": pd.Categorical(["x", "y", "x"]),
+                "value": [1.0, 2.0, 3.0],
+            }
+        )
+        new = pd.DataFrame(
+            {
+                "i": pd.Categorical(["b", "a", "a", "c"]),
+                "j": pd.Categorical(["x", "y", "x", "y"], ["y", "x"]),
+                "value": [3.0, 5.0, 1.0, 4.0],
+            }
+        )
+        snapshot = utils._RecordsSnapshot(old, dimension=2)
+        delta = utils._get_records_delta(snapshot, new, dimension=2)
+        self.assertEqual(delta["i"].tolist(), ["a", "c"])
+        self.assertEqual(delta["j"].tolist(), ["y", "y"])
+
+        # Domain columns that are not categorical are not matched
+        new["i"] = new["i"].astype(str)
+        self.assertIsNone(utils._get_records_delta(snapshot, new, 2))
+
     def test_isin(self):
         i = Set(self.m, "i")
         j = Set(self.m, "j")
@@ -3,11 +3,14 @@ from __future__ import annotations
 import os
 import unittest
 
+import numpy as np
 import pandas as pd
 
 import gamspy._symbols.implicits as implicits
 from gamspy import Container
 from gamspy import Equation
+from gamspy import Ord
+from gamspy import Parameter
 from gamspy import Set
 from gamspy import Variable
 from gamspy import VariableType
@@ -354,6 +357,46 @@ class VariableSuite(unittest.TestCase):
         with self.assertRaises(ValidationError):
             e1[j1, j2] = j3[j1, j2, j4] * 5 <= 5
 
+    def test_lazy_attributes(self):
+        i = Set(self.m, "i", records=["i1", "i2"])
+        x = Variable(self.m, "x", domain=[i])
+        e = Equation(self.m, "e", domain=[i])
+
+        # Attributes are created on first access and reused afterwards
+        self.assertEqual(x._implicit_attributes, {})
+        self.assertEqual(e._implicit_attributes, {})
+        self.assertIs(x.l, x.l)
+        self.assertIs(e.m, e.m)
+        self.assertEqual(list(x._implicit_attributes.keys()), ["l"])
+
+        self.assertEqual(x.up.gamsRepr(), "x.up(i)")
+        self.assertEqual(x["i1"].lo.gamsRepr(), 'x("i1").lo')
+        self.assertEqual(e[i].slack.gamsRepr(), "e(i).slack")
+
+    def test_array_accessors(self):
+        i = Set(self.m, "i", records=["i1", "i2", "i3"])
+        x = Variable(self.m, "x", domain=[i])
+        x.l[i] = Ord(i)
+        x.up["i2"] = 10
+
+        np.testing.assert_array_equal(x.l.toDense(), [1, 2, 3])
+        np.testing.assert_array_equal(x.up.toDense(), [np.inf, 10, np.inf])
+
+        a = Parameter(self.m, "a", domain=[i], records=[("i2", 5)])
+        np.testing.assert_array_equal(a[i].toDense(), [0, 5, 0])
+
+        # Attributes over a subset of the domain cannot be dense
+        with self.assertRaises(ValidationError):
+            x.l["i1"].toDense()
+
+        table = x.toArrow(columns=["i", "level"])
+        self.assertEqual(table.column_names, ["i", "level"])
+        self.assertEqual(table.column("i").to_pylist(), ["i1", "i2", "i3"])
+        self.assertEqual(table.column("level").to_pylist(), [1, 2, 3])
+
+        with self.assertRaises(ValidationError):
+            x.toArrow(columns=["unknown"])
+
 
 def variable_suite():
     suite = unittest.TestSuite()